@@ -1,5 +1,6 @@
 import {
   ObserveDataListener,
+  ObservePatchListener,
   ObserveErrorListener,
   CloseObserve,
 } from './types'
@@ -19,7 +20,27 @@ function observeListenerToNative(
   }
 }
 
-const { Observe, Unobserve, Get } =
+function observePatchListenerToNative(
+  onData: ObservePatchListener,
+  onError?: ObserveErrorListener
+): (
+  data: any,
+  isPatch: boolean,
+  checksum: number,
+  prevChecksum: number,
+  err: any,
+  obsId: number
+) => void {
+  return (data, isPatch, checksum, prevChecksum, err, obsId) => {
+    if (data) {
+      onData(JSON.parse(data), isPatch, checksum || 0, prevChecksum || 0)
+    } else if (err && onError) {
+      onError(convertDataToBasedError(JSON.parse(err)))
+    }
+  }
+}
+
+const { Observe, ObservePatches, Unobserve, Get } =
   require('../build/Release/based-node-addon') as {
     Observe: (
       clientId: number,
@@ -27,6 +48,20 @@ const { Observe, Unobserve, Get } =
       payload: any,
       cb: (data: any, checksum: number, err: any, obsId: number) => void
     ) => number
+    ObservePatches: (
+      clientId: number,
+      name: string,
+      payload: any,
+      keepValue: boolean,
+      cb: (
+        data: any,
+        isPatch: boolean,
+        checksum: number,
+        prevChecksum: number,
+        err: any,
+        obsId: number
+      ) => void
+    ) => number
     Unobserve: (clientId: number, subId: number) => void
     Get: (
       clientId: number,
@@ -63,6 +98,28 @@ export class BasedQuery<P = any, K = any> {
     }
   }
 
+  /**
+   * Like subscribe, but after the first value only the patches sent by the server are passed
+   * on. With keepValue false the native client doesn't keep its own patched copy of the value.
+   */
+  subscribePatches(
+    onData: ObservePatchListener,
+    onError?: ObserveErrorListener,
+    keepValue: boolean = false
+  ): CloseObserve {
+    const subId = ObservePatches(
+      this.client.clientId,
+      this.name,
+      JSON.stringify(this.query),
+      keepValue,
+      observePatchListenerToNative(onData, onError)
+    )
+
+    return () => {
+      Unobserve(this.client.clientId, subId)
+    }
+  }
+
   async get(): Promise<K> {
     return new Promise((resolve, reject) => {
       const cb = (data, err, subId) => {
@@ -7,6 +7,17 @@ export type ObserveOpts = {
 
 export type ObserveDataListener<K = any> = (data: K, checksum: number) => void
 
+/**
+ * Gets the full value first (isPatch false), then the patches to apply to it. A full value can
+ * come again at any time and replaces the previous one.
+ */
+export type ObservePatchListener = (
+  data: any,
+  isPatch: boolean,
+  checksum: number,
+  prevChecksum: number
+) => void
+
 export type ObserveErrorListener = (err: BasedError) => void
 
 export type CloseObserve = () => void
@@ -17,6 +17,14 @@ struct ObserveCallbackData {
     std::string error;
     int id;
 };
+struct ObservePatchesCallbackData {
+    std::string data;
+    bool isPatch;
+    uint64_t checksum;
+    uint64_t prevChecksum;
+    std::string error;
+    int id;
+};
 
 Napi::ThreadSafeFunction authTsfn;
 std::map<int, Napi::ThreadSafeFunction> fnStore;
@@ -107,6 +115,30 @@ void observeCb(const char* data, uint64_t checksum, const char* error, int id) {
     obsStore.at(id).BlockingCall(d, callback);
 }
 
+void observePatchesCb(const char* data,
+                      bool isPatch,
+                      uint64_t checksum,
+                      uint64_t prevChecksum,
+                      const char* error,
+                      int id) {
+    if (obsStore.find(id) == obsStore.end()) {
+        return;
+    }
+    auto callback = [](Napi::Env env, Napi::Function jsCallback,
+                       ObservePatchesCallbackData* data) {
+        jsCallback.Call(
+            {Napi::String::New(env, data->data), Napi::Boolean::New(env, data->isPatch),
+             Napi::Number::New(env, data->checksum), Napi::Number::New(env, data->prevChecksum),
+             Napi::String::New(env, data->error), Napi::Number::New(env, data->id)});
+
+        delete data;
+    };
+    ObservePatchesCallbackData* d =
+        new ObservePatchesCallbackData{data, isPatch, checksum, prevChecksum, error, id};
+
+    obsStore.at(id).BlockingCall(d, callback);
+}
+
 Napi::Value NewClient(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
 
@@ -177,6 +209,45 @@ Napi::Value Observe(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, id);
 }
 
+Napi::Value ObservePatches(const Napi::CallbackInfo& info) {
+    /*
+    ObservePatches: (
+      clientId: number,
+      name: string,
+      payload: any,
+      keepValue: boolean,
+      cb: (
+        data: any,
+        isPatch: boolean,
+        checksum: number,
+        prevChecksum: number,
+        err: any,
+        obsId: number
+      ) => void
+    ) => number
+    */
+
+    Napi::Env env = info.Env();
+
+    int clientId = info[0].As<Napi::Number>().Int32Value();
+    std::string name = info[1].As<Napi::String>().Utf8Value();
+    std::string payload = "";
+    if (info[2].IsString()) {
+        payload = info[2].As<Napi::String>().Utf8Value();
+    } else if (info[2].IsNumber()) {
+        payload = info[2].As<Napi::Number>().ToString();
+    }
+    bool keepValue = info[3].ToBoolean().Value();
+
+    int id = Based__observe_patches(clientId, name.data(), payload.data(), keepValue,
+                                    observePatchesCb);
+
+    auto fn = info[4].As<Napi::Function>();
+    obsStore[id] = Napi::ThreadSafeFunction::New(env, fn, "callback-observe-patches", 0, 2);
+
+    return Napi::Number::New(env, id);
+}
+
 Napi::Value Unobserve(const Napi::CallbackInfo& info) {
     /*
         Unobserve: (clientId: number, subId: number) => void
@@ -471,11 +542,51 @@ Napi::Value GetAuthState(const Napi::CallbackInfo& info) {
     return Napi::String::New(env, state);
 }
 
+Napi::Value SetConnectionSharing(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    bool enabled = info[0].As<Napi::Boolean>().Value();
+    Based__set_connection_sharing(enabled);
+
+    return env.Undefined();
+}
+
+Napi::Value GetSessionsStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    auto stats = Based__get_sessions_stats();
+
+    return Napi::String::New(env, stats);
+}
+
+Napi::Value SetMailboxOptions(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    int clientId = info[0].As<Napi::Number>().Int32Value();
+    int subId = info[1].As<Napi::Number>().Int32Value();
+    uint32_t capacity = info[2].As<Napi::Number>().Uint32Value();
+    int policy = info[3].As<Napi::Number>().Int32Value();
+    Based__set_mailbox_options(clientId, subId, capacity, policy);
+
+    return env.Undefined();
+}
+
+Napi::Value GetMailboxStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    int clientId = info[0].As<Napi::Number>().Int32Value();
+    auto stats = Based__get_mailbox_stats(clientId);
+    if (!stats) return env.Null();
+
+    return Napi::String::New(env, stats);
+}
+
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
     // clang-format off
     exports.Set(Napi::String::New(env, "NewClient"), Napi::Function::New(env, NewClient));
     exports.Set(Napi::String::New(env, "ConnectToUrl"), Napi::Function::New(env, ConnectToUrl));
     exports.Set(Napi::String::New(env, "Observe"), Napi::Function::New(env, Observe));
+    exports.Set(Napi::String::New(env, "ObservePatches"), Napi::Function::New(env, ObservePatches));
     exports.Set(Napi::String::New(env, "Unobserve"), Napi::Function::New(env, Unobserve));
     exports.Set(Napi::String::New(env, "Get"), Napi::Function::New(env, Get));
     exports.Set(Napi::String::New(env, "Call"), Napi::Function::New(env, Call));
@@ -486,6 +597,10 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set(Napi::String::New(env, "Disconnect"), Napi::Function::New(env, Disconnect));
     exports.Set(Napi::String::New(env, "DeleteClient"), Napi::Function::New(env, DeleteClient));
     exports.Set(Napi::String::New(env, "GetAuthState"), Napi::Function::New(env, GetAuthState));
+    exports.Set(Napi::String::New(env, "SetConnectionSharing"), Napi::Function::New(env, SetConnectionSharing));
+    exports.Set(Napi::String::New(env, "GetSessionsStats"), Napi::Function::New(env, GetSessionsStats));
+    exports.Set(Napi::String::New(env, "SetMailboxOptions"), Napi::Function::New(env, SetMailboxOptions));
+    exports.Set(Napi::String::New(env, "GetMailboxStats"), Napi::Function::New(env, GetMailboxStats));
     // clang-format on
     return exports;
 }
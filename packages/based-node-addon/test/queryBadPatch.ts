@@ -0,0 +1,91 @@
+import test from 'ava'
+import { BasedClient } from '..'
+import uws from '@based/uws'
+import { wait } from '@saulx/utils'
+
+// | 4 header | 8 id | 8 checksum | * payload |, len doesn't count the header
+const encode = (type: number, parts: Buffer[]): Buffer => {
+  const body = Buffer.concat(parts)
+  const header = Buffer.alloc(4)
+  header.writeInt32LE((body.length << 4) + (type << 1))
+  return Buffer.concat([header, body])
+}
+
+// checksums small enough for the low half
+const u64 = (n: number): Buffer => {
+  const b = Buffer.alloc(8)
+  b.writeUInt32LE(n, 0)
+  return b
+}
+
+test.serial('a patch that fails is replaced by the full value', async (t) => {
+  const subscribes: number[] = []
+  let listenSocket: any
+
+  // The real server never sends a broken patch, this one does
+  uws
+    .App()
+    .ws('/*', {
+      message: (ws, message) => {
+        const buff = Buffer.from(message)
+        let offset = 0
+        while (offset < buff.length) {
+          const header = buff.readInt32LE(offset)
+          // outgoing lengths include the header
+          const len = header >> 4
+          const type = (header & 15) >> 1
+          if (type === 1) {
+            const id = buff.slice(offset + 4, offset + 12)
+            subscribes.push(buff.readUInt32LE(offset + 12))
+            if (subscribes.length === 1) {
+              ws.send(
+                encode(1, [id, u64(1), Buffer.from('{"a":[1,2,3]}')]),
+                true
+              )
+              // copies element 0, then reads past the end of the array
+              ws.send(
+                encode(2, [
+                  id,
+                  u64(2),
+                  u64(1),
+                  Buffer.from('{"a":[2,[3,[1,1,0],[1,1,9]]]}'),
+                ]),
+                true
+              )
+            } else {
+              ws.send(
+                encode(1, [id, u64(3), Buffer.from('{"a":[4,5,6]}')]),
+                true
+              )
+            }
+          }
+          offset += len
+        }
+      },
+    })
+    .listen(9911, (token) => {
+      listenSocket = token
+    })
+
+  const client = new BasedClient()
+  client.connect({
+    url: async () => {
+      return 'ws://localhost:9911'
+    },
+  })
+
+  const results: any[] = []
+  const close = client.query('counter', {}).subscribe((d) => {
+    results.push(d)
+  })
+
+  await wait(2e3)
+
+  t.deepEqual(results, [{ a: [1, 2, 3] }, { a: [4, 5, 6] }])
+  // asked again without a checksum, so the server sends everything
+  t.deepEqual(subscribes, [0, 0])
+
+  close()
+  client.disconnect()
+  uws.us_listen_socket_close(listenSocket)
+})
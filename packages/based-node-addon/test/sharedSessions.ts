@@ -0,0 +1,94 @@
+import test from 'ava'
+import { BasedClient } from '..'
+import { BasedServer } from '@based/server'
+import { wait } from '@saulx/utils'
+
+const {
+  Observe,
+  Unobserve,
+  SetConnectionSharing,
+  GetSessionsStats,
+  SetMailboxOptions,
+  GetMailboxStats,
+} = require('../build/Release/based-node-addon') as {
+  Observe: (
+    clientId: number,
+    name: string,
+    payload: any,
+    cb: (data: any, checksum: number, err: any, obsId: number) => void
+  ) => number
+  Unobserve: (clientId: number, subId: number) => void
+  SetConnectionSharing: (enabled: boolean) => void
+  GetSessionsStats: () => string
+  SetMailboxOptions: (
+    clientId: number,
+    subId: number,
+    capacity: number,
+    policy: number
+  ) => void
+  GetMailboxStats: (clientId: number) => string
+}
+
+test.serial('mailbox options move with the subscription', async (t) => {
+  const server = new BasedServer({
+    port: 9910,
+    functions: {
+      configs: {
+        counter: {
+          type: 'query',
+          uninstallAfterIdleTime: 1e3,
+          fn: (_, __, update) => {
+            let cnt = 0
+            update(cnt)
+            const counter = setInterval(() => {
+              update(++cnt)
+            }, 100)
+            return () => {
+              clearInterval(counter)
+            }
+          },
+        },
+      },
+    },
+  })
+  await server.start()
+
+  SetConnectionSharing(true)
+
+  const a = new BasedClient()
+  const b = new BasedClient()
+  await a.connect({ url: 'ws://localhost:9910' })
+  await b.connect({ url: 'ws://localhost:9910' })
+
+  t.deepEqual(JSON.parse(GetSessionsStats()), {
+    handles: 2,
+    sessions: 1,
+    shared: 1,
+    handlesPerSession: [2],
+  })
+
+  const subId = Observe(b.clientId, 'counter', '{}', () => {})
+  SetMailboxOptions(b.clientId, subId, 4, 1)
+
+  const options = { capacity: 4, policy: 1, dropped: 0 }
+  t.deepEqual(JSON.parse(GetMailboxStats(b.clientId)).subscriptions[subId], options)
+
+  await wait(500)
+
+  // a keeps the connection, b gets a session of its own and takes the subscription along
+  b.disconnect()
+
+  t.deepEqual(JSON.parse(GetSessionsStats()), {
+    handles: 2,
+    sessions: 2,
+    shared: 1,
+    handlesPerSession: [1, 1],
+  })
+  t.deepEqual(JSON.parse(GetMailboxStats(b.clientId)).subscriptions[subId], options)
+  t.is(JSON.parse(GetMailboxStats(a.clientId)).subscriptions[subId], undefined)
+
+  Unobserve(b.clientId, subId)
+  await a.destroy()
+  await b.destroy()
+  SetConnectionSharing(false)
+})
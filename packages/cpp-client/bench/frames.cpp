@@ -0,0 +1,73 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "frameview.hpp"
+#include "utility.hpp"
+
+/**
+ * Measures how many WebSocket messages per second the client can decode, depending on how many
+ * frames are packed in each message. Every frame is a SUBSCRIPTION_DATA frame with a small json
+ * payload, decoded the same way BasedClient::handle_frame does it.
+ */
+
+const int32_t SUBSCRIPTION_DATA = 1;
+
+std::string make_message(int frames_per_message) {
+    std::vector<uint8_t> buff;
+    std::string payload = R"({"id":"ma1234","title":"Small update","count":12})";
+
+    for (int i = 0; i < frames_per_message; i++) {
+        // | 4 header | 8 id | 8 checksum | * payload |
+        Utility::append_header(buff, SUBSCRIPTION_DATA, 0, 16 + payload.length());
+        Utility::append_bytes(buff, 1000 + i, 8);
+        Utility::append_bytes(buff, 0xabcdef0123456789 + i, 8);
+        Utility::append_string(buff, payload);
+    }
+
+    return std::string(buff.begin(), buff.end());
+}
+
+void bench(int frames_per_message, int total_frames) {
+    std::string message = make_message(frames_per_message);
+    int messages = total_frames / frames_per_message;
+
+    uint64_t checksum_sum = 0;
+    size_t payload_bytes = 0;
+
+    auto t_start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < messages; i++) {
+        FrameIterator frames{FrameView(message)};
+        FrameView frame;
+        while (frames.next(frame)) {
+            int32_t header = frame.header();
+            int32_t len = Utility::get_payload_len(header);
+            if (Utility::get_payload_type(header) != SUBSCRIPTION_DATA) continue;
+
+            obs_id_t obs_id = (obs_id_t)frame.read_u64(4);
+            checksum_t checksum = frame.read_u64(12);
+            std::string payload = frame.sub(20, len - 16).to_string();
+
+            checksum_sum += checksum + obs_id;
+            payload_bytes += payload.length();
+        }
+    }
+
+    auto t_end = std::chrono::high_resolution_clock::now();
+    double elapsed_s = std::chrono::duration<double>(t_end - t_start).count();
+
+    std::cout << ">> " << frames_per_message << " frames/message --- " << (messages / elapsed_s)
+              << " messages/s, " << (messages * frames_per_message / elapsed_s) << " frames/s"
+              << " (" << payload_bytes << " payload bytes, " << checksum_sum % 10 << ")"
+              << std::endl;
+}
+
+int main() {
+    const int total_frames = 10000000;
+
+    for (int frames_per_message : {1, 10, 100}) {
+        bench(frames_per_message, total_frames);
+    }
+}
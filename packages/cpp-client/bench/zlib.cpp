@@ -0,0 +1,142 @@
+#include <zlib.h>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "compression.hpp"
+#include "utility.hpp"
+
+/**
+ * Compares the previous deflate/inflate implementation, which set up and tore down a z_stream for
+ * every message, with the one in Utility that reuses a per-thread stream and buffer, and reserves
+ * the output from the ratio of the previous payload. Payloads go from the compression threshold
+ * (150 B) up to 10 MB.
+ *
+ * Utility uses the backend selected at build time, build with BASED_LIBDEFLATE to measure
+ * libdeflate instead of zlib.
+ */
+
+namespace Legacy {
+std::string deflate_string(const std::string& str) {
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+    if (deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) !=
+        Z_OK)
+        throw(std::runtime_error("deflateInit failed while compressing."));
+
+    zs.next_in = (Bytef*)str.data();
+    zs.avail_in = str.size();
+
+    int ret;
+    char outbuffer[32768];
+    std::string outstring;
+    do {
+        zs.next_out = reinterpret_cast<Bytef*>(outbuffer);
+        zs.avail_out = sizeof(outbuffer);
+        ret = deflate(&zs, Z_FINISH);
+        if (outstring.size() < zs.total_out) {
+            outstring.append(outbuffer, zs.total_out - outstring.size());
+        }
+    } while (ret == Z_OK);
+    deflateEnd(&zs);
+
+    if (ret != Z_STREAM_END) throw(std::runtime_error("deflate failed"));
+    return outstring;
+}
+
+std::string inflate_string(const std::string& str) {
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+    if (inflateInit2(&zs, -MAX_WBITS) != Z_OK)
+        throw(std::runtime_error("inflateInit failed while decompressing."));
+
+    zs.next_in = (Bytef*)str.data();
+    zs.avail_in = str.size();
+
+    int ret;
+    char outbuffer[32768];
+    std::string outstring;
+    do {
+        zs.next_out = reinterpret_cast<Bytef*>(outbuffer);
+        zs.avail_out = sizeof(outbuffer);
+        ret = inflate(&zs, 0);
+        if (outstring.size() < zs.total_out) {
+            outstring.append(outbuffer, zs.total_out - outstring.size());
+        }
+    } while (ret == Z_OK);
+    inflateEnd(&zs);
+
+    if (ret != Z_STREAM_END) throw(std::runtime_error("inflate failed"));
+    return outstring;
+}
+}  // namespace Legacy
+
+/**
+ * Json-ish payload, repetitive enough to compress like real observable data does.
+ */
+std::string make_payload(size_t size) {
+    std::string payload = "[";
+    int i = 0;
+    while (payload.size() < size) {
+        payload += "{\"id\":\"ma" + std::to_string(i) + "\",\"title\":\"Item number " +
+                   std::to_string(i * 7919 % 1000) + "\",\"done\":" +
+                   (i % 3 ? "false" : "true") + "},";
+        i++;
+    }
+    payload.resize(size);
+    return payload;
+}
+
+template <typename F>
+double per_second(int iterations, F fn) {
+    auto t_start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        fn();
+    }
+    auto t_end = std::chrono::high_resolution_clock::now();
+    return iterations / std::chrono::duration<double>(t_end - t_start).count();
+}
+
+void bench(size_t size) {
+    std::string payload = make_payload(size);
+    std::string deflated = Utility::deflate_string(payload);
+
+    // Different backends don't produce the same bytes, so only check that they round trip.
+    if (Legacy::inflate_string(deflated) != payload ||
+        Utility::inflate_string(Legacy::deflate_string(payload)) != payload) {
+        std::cerr << "Mismatch for " << size << " bytes" << std::endl;
+        exit(1);
+    }
+
+    int iterations = std::max<size_t>(5, 20000000 / size);
+    size_t sink = 0;
+
+    double legacy_deflate =
+        per_second(iterations, [&]() { sink += Legacy::deflate_string(payload).size(); });
+    double new_deflate =
+        per_second(iterations, [&]() { sink += Utility::deflate_string(payload).size(); });
+    double legacy_inflate =
+        per_second(iterations, [&]() { sink += Legacy::inflate_string(deflated).size(); });
+    double new_inflate =
+        per_second(iterations, [&]() { sink += Utility::inflate_string(deflated).size(); });
+
+    std::cout << ">> " << size << " B (" << deflated.size() << " B deflated)" << std::endl;
+    std::cout << "   deflate: " << legacy_deflate << " -> " << new_deflate << " ops/s ("
+              << new_deflate / legacy_deflate << "x)" << std::endl;
+    std::cout << "   inflate: " << legacy_inflate << " -> " << new_inflate << " ops/s ("
+              << new_inflate / legacy_inflate << "x)" << std::endl;
+
+    if (sink == 0) std::cout << std::endl;
+}
+
+int main() {
+    std::cout << "Backend: " << Compression::backend().name() << std::endl;
+
+    for (size_t size : {150, 1000, 10000, 100000, 1000000, 10000000}) {
+        bench(size);
+    }
+}
@@ -21,6 +21,23 @@ extern "C" char* Based__get_service(based_id client_id,
                                     bool optional_key,
                                     bool http);
 
+/**
+ * Like Based__get_service, without blocking the caller. The callback gets the url, or an error
+ * if the discovery keeps failing, along with the id returned by this call.
+ */
+extern "C" int Based__get_service_async(based_id client_id,
+                                       char* cluster,
+                                       char* org,
+                                       char* project,
+                                       char* env,
+                                       char* name,
+                                       char* key,
+                                       bool optional_key,
+                                       bool http,
+                                       void (*cb)(const char* /* Url */,
+                                                  const char* /* Error */,
+                                                  int /* request_id */));
+
 extern "C" void Based__connect_to_url(based_id client_id, char* url);
 extern "C" void Based__connect(based_id client_id,
                                char* cluster,
@@ -45,6 +62,27 @@ extern "C" int Based__observe(based_id client_id,
                                          const char* /* Error*/,
                                          int /*sub_id*/));
 
+/**
+ * Observe a function, receiving the patches sent by the server instead of the whole value on
+ * every change. The callback first gets the full value (is_patch false), then every patch with
+ * the checksum it leads to and the checksum it applies to. A full value can come again at any
+ * time, when the client went out of sync, and replaces the previous one. Unobserve with
+ * Based__unobserve.
+ *
+ * With keep_value false the client doesn't keep its own patched copy of the value if nothing
+ * else needs it, updates cost the size of the patch instead of the size of the value.
+ */
+extern "C" int Based__observe_patches(based_id client_id,
+                                      char* name,
+                                      char* payload,
+                                      bool keep_value,
+                                      void (*cb)(const char* /* Data or patch */,
+                                                 bool /* Is patch */,
+                                                 uint64_t /* Checksum */,
+                                                 uint64_t /* Previous checksum */,
+                                                 const char* /* Error */,
+                                                 int /*sub_id*/));
+
 extern "C" int Based__get(based_id client_id,
                           char* name,
                           char* payload,
@@ -81,4 +119,193 @@ extern "C" void Based__channel_publish(based_id client_id,
                                        char* payload,
                                        char* message);
 
+/**
+ * Send all the queued requests right away, without waiting for the flush window.
+ */
+extern "C" void Based__flush(based_id client_id);
+
+/**
+ * Requests are batched: they're held for window_us microseconds (0 means until the network
+ * thread picks them up) so that they can be sent in a single write, unless the queued requests
+ * reach max_bytes.
+ */
+extern "C" void Based__set_flush_options(based_id client_id,
+                                         uint32_t window_us,
+                                         uint32_t max_bytes);
+
+/**
+ * Outgoing payloads longer than threshold bytes are deflated at the given level (1 fastest to 9
+ * smallest, -1 for the zlib default, 0 to never compress). They're sent uncompressed anyway when
+ * original size / deflated size is below min_ratio. Other levels, and a negative or NaN
+ * min_ratio, are rejected.
+ */
+extern "C" void Based__set_compression_options(based_id client_id,
+                                               uint32_t threshold,
+                                               int32_t level,
+                                               double min_ratio);
+
+/**
+ * Json object with, for every message type, how many payloads were sent and deflated, the bytes
+ * before and after deflate, and the resulting ratio.
+ */
+extern "C" char* Based__get_compression_stats(based_id client_id);
+
+/**
+ * Bound the queue of one type of request, while the connection is down or congested.
+ *
+ * type: 0 function, 1 observe, 2 unobserve, 3 get, 4 auth, 5 channel subscribe, 6 channel
+ * publish, 7 channel unsubscribe.
+ * max_messages, max_bytes: 0 means no limit.
+ * overflow_policy: what happens to a request that doesn't fit.
+ *   0 block: the caller waits until the queue is sent.
+ *   1 drop oldest: the oldest requests are dropped to make room (the default).
+ *   2 drop newest: the new request is dropped.
+ *   3 fail: the new request is dropped and its callback fires with an error.
+ * Dropped observe and channel subscribe requests are sent again on reconnection.
+ */
+extern "C" void Based__set_queue_limits(based_id client_id,
+                                        int type,
+                                        uint32_t max_messages,
+                                        uint32_t max_bytes,
+                                        int overflow_policy);
+
+/**
+ * The client stops writing to the connection while more than max_bytes are still waiting to be
+ * sent (4MB by default), requests are kept in the queues instead. 0 means no limit.
+ */
+extern "C" void Based__set_max_buffered_amount(based_id client_id, uint32_t max_bytes);
+
+/**
+ * Json object with the depth (messages and bytes) of every request queue, how many requests
+ * they dropped or blocked, and the bytes buffered in the connection.
+ */
+extern "C" char* Based__get_queue_stats(based_id client_id);
+
+/**
+ * Run the callbacks on a pool of `threads` threads instead of the network thread, so that slow
+ * callbacks don't hold up the connection. 0 (the default) runs them on the network thread.
+ * Callbacks of the same subscription still run in order, one at a time.
+ */
+extern "C" void Based__set_dispatcher_threads(based_id client_id, uint32_t threads);
+
+/**
+ * With a dispatcher, every observe and channel subscription has a mailbox of pending callbacks.
+ * sub_id: the subscription, or -1 for the default of the subscriptions made from now on.
+ * capacity: pending callbacks, 0 for no limit. The default is 16.
+ * policy: when the mailbox is full,
+ *   0 conflate: the oldest pending callback is dropped, so the latest value is always delivered
+ *     (the default).
+ *   1 drop: the new callback is dropped.
+ */
+extern "C" void Based__set_mailbox_options(based_id client_id,
+                                           int sub_id,
+                                           uint32_t capacity,
+                                           int policy);
+
+/**
+ * Json object with the default mailbox options, and the options and dropped callbacks of every
+ * subscription that has options of its own or a mailbox.
+ */
+extern "C" char* Based__get_mailbox_stats(based_id client_id);
+
+/**
+ * Discovery returns all the hubs of the env, and they're ranked by how fast a connection to each
+ * of them is. The client connects to the fastest one and, when it fails, to the next ones before
+ * asking discovery again. With an interval_ms, the hubs are ranked again that often while
+ * connected: the open connection stays, the new ranking is for the next reconnect and for the
+ * clients that start next. 0 (the default) ranks them only on connect.
+ */
+extern "C" void Based__set_hub_reevaluation(based_id client_id, uint32_t interval_ms);
+
+/**
+ * Backoff between reconnect attempts, which run on a timer without blocking the network thread.
+ * The delay before attempt n is random between 0 and min(base_ms * multiplier^(n-1), max_ms), so
+ * that clients that lost the same server don't all come back at the same time. The default is
+ * 100ms, 2 and 5000ms.
+ */
+extern "C" void Based__set_reconnect_options(based_id client_id,
+                                             uint32_t base_ms,
+                                             double multiplier,
+                                             uint32_t max_ms);
+
+/**
+ * Json object with the number of reconnect attempts, of successful reconnects, the current run
+ * of failed attempts, and the last delay in ms.
+ */
+extern "C" char* Based__get_reconnect_stats(based_id client_id);
+
+/**
+ * While connected, a WebSocket ping is sent every interval_ms (5000 by default, 0 disables it).
+ * When max_missed_pongs pings in a row (2 by default) got no pong and nothing else was received,
+ * the link is considered dead and the client reconnects right away.
+ */
+extern "C" void Based__set_heartbeat(based_id client_id,
+                                     uint32_t interval_ms,
+                                     uint32_t max_missed_pongs);
+
+/**
+ * Json object with the number of pings, pongs, missed pongs and dropped dead links, the last
+ * round trip time and its moving average in ms, and a histogram of the round trip times: each
+ * bucket has a count and leMs, its upper bound, except the last one.
+ */
+extern "C" char* Based__get_heartbeat_stats(based_id client_id);
+
+/**
+ * Keep a second, authenticated connection to another hub of the env while connected (off by
+ * default). When the connection is lost, the standby takes over at once and only the
+ * subscriptions are sent again, instead of discovering, connecting and authenticating anew. The
+ * number of failovers is in Based__get_reconnect_stats.
+ */
+extern "C" void Based__set_standby(based_id client_id, bool enabled);
+
+/**
+ * Bound the memory taken by the cached values of the observables, in bytes (64MB by default, 0
+ * for no limit). Once over it, the values of the observables that are no longer observed are
+ * dropped, least recently used first. The values of active observables are always kept.
+ */
+extern "C" void Based__set_cache_budget(based_id client_id, uint64_t bytes);
+
+/**
+ * Json object with the bytes and entries in the observable cache, how many of them are pinned
+ * by active observables, the number of evictions and the budget.
+ */
+extern "C" char* Based__get_cache_stats(based_id client_id);
+
+/**
+ * Keep the values of the observables in a file, so that after a restart observe fires right
+ * away with the last known value, while the server only sends it again if it changed. The values
+ * are stored per env, at most once a second for each observable. Only one process at a time can
+ * use a file. It's loaded in the background, observables made before that don't use it.
+ * Disabled by default, an empty path disables it again.
+ */
+extern "C" void Based__set_persistent_cache(char* path);
+
+/**
+ * Number of network threads shared by all the clients of the process, the default is one per
+ * core. Must be called before the first Based__new_client, it's ignored afterwards.
+ */
+extern "C" void Based__set_io_threads(uint32_t threads);
+
+/**
+ * Let clients share their connection. Clients that connect with the same options and auth state
+ * then use a single WebSocket: identical observables are only subscribed once and every client
+ * gets the updates, and the socket is closed when the last of them is deleted or disconnects.
+ * Settings like the flush or compression options are shared by the clients of a connection.
+ * Off by default, only affects the connections made after the call.
+ */
+extern "C" void Based__set_connection_sharing(bool enabled);
+
+/**
+ * Json object with the number of clients, of connections, and of clients on each connection.
+ */
+extern "C" char* Based__get_sessions_stats();
+
+/**
+ * Where the last hub of every env is remembered, so that connecting and reconnecting go to it
+ * right away while discovery runs in parallel, and only switch hubs if it fails. Entries expire
+ * after ttl_seconds. The file only holds hub urls and is readable by the user only, a ttl of one
+ * hour suits most envs. Disabled by default, an empty path disables it again.
+ */
+extern "C" void Based__set_discovery_cache(char* path, uint32_t ttl_seconds);
+
 #endif
\ No newline at end of file
@@ -3,148 +3,183 @@
 
 #include "json.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <map>
 #include <string>
+#include <vector>
 
 using namespace nlohmann::literals;
 using json = nlohmann::json;
 
 namespace Diff {
 
-template <typename T>
-bool vec_contains(std::vector<T> vec, T item) {
-    if (std::find(vec.begin(), vec.end(), item) != vec.end()) return true;
-    else return false;
-};
-
-inline json apply_patch(json, json);
-
-inline json apply_array_patch(json& value, json patch) {
+/**
+ * The patch engine works in place: value is modified, untouched subtrees are kept as they are and
+ * array elements are moved to their new position instead of copied. Values inserted by the patch
+ * are moved out of it, so the patch can't be used again afterwards.
+ *
+ * There's no strong exception guarantee: a patch that doesn't fit value (an index out of range, a
+ * missing key) throws halfway through, and value is left unspecified. Callers have to discard it
+ * and get the whole value again, use apply_patch to keep the original.
+ */
+inline void apply_patch_in_place(json& value, json& patch);
+
+/**
+ * @brief Apply an array patch to value, an array.
+ *
+ * | new length | ...operations |, where an operation is one of
+ * 0 - insert, ...values
+ * 1 - copy, amount, index in value
+ * 2 - patch, index in value, ...patches
+ *
+ * Every operation reads the original value, an element can be copied to more than one position.
+ */
+inline void apply_array_patch(json& value, json& patch) {
     if (!value.is_array()) {
-        return -1;
+        value = -1;
+        return;
     }
 
-    json new_array = json::array();
+    json::array_t& source = value.get_ref<json::array_t&>();
+    int size = patch.size();
+    int source_size = source.size();
 
-    json patches = json::array();
-    std::vector<int> used;
+    // Elements used once are moved, the ones used more often are copied. Out of range indexes
+    // aren't tracked, reading them throws below.
+    std::vector<bool> used(source_size, false);
+    std::vector<bool> shared(source_size, false);
+    size_t inserted = 0;
+    for (int i = 1; i < size; i++) {
+        const json& operation = patch.at(i);
+        int type = operation.at(0);
+        int pivot, range;
+        if (type == 0) {
+            inserted += operation.size() - 1;
+            continue;
+        } else if (type == 1) {
+            pivot = operation.at(2);
+            range = (int)operation.at(1) + pivot;
+        } else if (type == 2) {
+            pivot = operation.at(1);
+            range = (int)operation.size() - 2 + pivot;
+        } else {
+            continue;
+        }
+        for (int j = std::max(pivot, 0); j < std::min(range, source_size); j++) {
+            if (used[j]) {
+                shared[j] = true;
+            } else {
+                used[j] = true;
+            }
+        }
+    }
 
-    int array_index = -1;
-    int size = patch.size();
+    json::array_t new_array;
+    if (size > 0 && patch.at(0).is_number_unsigned()) {
+        // The new length comes from the server, a bogus one mustn't allocate more than the patch
+        // could ever fill with the elements it has.
+        size_t limit = 2 * (size_t)source_size + inserted;
+        new_array.reserve(std::min(patch.at(0).get<size_t>(), limit));
+    }
+
+    auto take = [&](int j) {
+        json& el = source.at(j);
+        if (shared[j]) {
+            new_array.push_back(el);
+        } else {
+            new_array.push_back(std::move(el));
+        }
+    };
 
     for (int i = 1; i < size; i++) {
-        json operation = patch.at(i);
-        // 0 - insert, value
-        // 1 - from , index, amount (can be a copy a well)
-        // 2 - amount, index
-        json type = operation.at(0);
+        json& operation = patch.at(i);
+        int type = operation.at(0);
         if (type == 0) {
             int op_size = operation.size();
             for (int j = 1; j < op_size; j++) {
-                new_array[++array_index] = operation.at(j);
+                new_array.push_back(std::move(operation.at(j)));
             }
         } else if (type == 1) {
-            int pivot = (int)operation.at(2);
+            int pivot = operation.at(2);
             int range = (int)operation.at(1) + pivot;
-            for (int j = pivot; j < range; j++) {
-                if (value.at(j).is_object() && vec_contains(used, j)) {
-                    // TODO: check how memory works here, does the instance get copied (since it's a
-                    // reference)
-                    json copy = value.at(j);
-                    new_array[++array_index] = copy;
-                } else {
-                    if (value.is_object()) {
-                        used[j] = true;
-                    }
-                    new_array[++array_index] = value.at(j);
-                }
-            }
+            for (int j = pivot; j < range; j++) take(j);
         } else if (type == 2) {
-            int pivot = (int)operation.at(1);
+            int pivot = operation.at(1);
             int range = (int)operation.size() - 2 + pivot;
             for (int j = pivot; j < range; j++) {
-                // store in map (with struct) on index
-
-                json patch = json::array();
-                patch.push_back(++array_index);
-                patch.push_back(j);
-                patch.push_back(operation.at(j - pivot + 2));
-                patches.push_back(patch);
+                take(j);
+                apply_patch_in_place(new_array.back(), operation.at(j - pivot + 2));
             }
         }
     }
 
-    for (auto& patch : patches) {
-        // if nested patch MAP has a struct on index use that one <index, {j, op}>
-        int index = (int)patch.at(0);
-        int j = (int)patch.at(1);
-        auto operation = patch.at(2);
-        // TODO: use a reference here based on "used"
-        auto x = value.at(j);
-        auto new_obj = apply_patch(x, operation);
-        new_array[index] = new_obj;
-    }
-
-    return new_array;
+    value = std::move(new_array);
 }
 
-inline int nested_apply_patch(json& value, std::string key, json patch) {
+inline void nested_apply_patch(json& value, const std::string& key, json& patch) {
     if (patch.is_array()) {
-        json type = patch.at(0);
+        int type = patch.at(0);
         if (type == 0) {
-            value[key] = patch.at(1);
+            value[key] = std::move(patch.at(1));
         } else if (type == 1) {
             if (value.is_array()) {
                 int idx = std::stoi(key);
                 value.erase(idx);
             } else {
-                // std::cout << "key = " << key << std::endl;
                 value.erase(key);
             }
         } else if (type == 2) {
-            json res = apply_array_patch(value.at(key), patch.at(1));
-            value[key] = res;
+            apply_array_patch(value.at(key), patch.at(1));
         }
-        return 0;
     } else if (patch.is_object()) {
+        json& target = value[key];
         for (auto& el : patch.items()) {
-            nested_apply_patch(value[key], el.key(), patch[el.key()]);
+            nested_apply_patch(target, el.key(), el.value());
         }
-        return 0;
     }
-    return 0;
 }
-inline json apply_patch(json value, json patch) {
+
+inline void apply_patch_in_place(json& value, json& patch) {
     if (patch.is_array()) {
-        json type = patch.at(0);
+        int type = patch.at(0);
         if (type == 0) {
-            return patch.at(1);
+            value = std::move(patch.at(1));
         } else if (type == 1) {
-            return nullptr;
+            value = nullptr;
         } else if (type == 2) {
-            return apply_array_patch(value, patch.at(1));
+            apply_array_patch(value, patch.at(1));
+        } else {
+            value = 0;
         }
-        return 0;
+        return;
     }
     if (patch.is_object()) {
         if (patch.contains("___$toObject")) {
             json v = json::object();
             for (int i = 0; i < value.size(); i++) {
-                v[std::to_string(i)] = value.at(i);
+                v[std::to_string(i)] = std::move(value.at(i));
             }
-            value = v;
+            value = std::move(v);
         }
         for (auto& el : patch.items()) {
             if (el.key() != "___$toObject") {
-                int r = nested_apply_patch(value, el.key(), patch[el.key()]);
-                if (r != 0) return -1;
+                nested_apply_patch(value, el.key(), el.value());
             }
         }
     }
+}
+
+/**
+ * @brief Apply patch to value and return the result. Move the value in to avoid copying it.
+ *
+ * The patch is applied to the copy, a value passed in by copy is untouched when it throws.
+ */
+inline json apply_patch(json value, json patch) {
+    apply_patch_in_place(value, patch);
     return value;
 };
 
 };  // namespace Diff
 
-#endif
\ No newline at end of file
+#endif
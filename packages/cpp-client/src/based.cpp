@@ -1,33 +1,46 @@
 #include "based.h"
 #include "basedclient.hpp"
+#include "discoverycache.hpp"
+#include "iopool.hpp"
+#include "persistentcache.hpp"
+#include "sessions.hpp"
 
 #include <map>
 
-std::map<based_id, BasedClient*> clients;
 based_id idx = 0;
 char get_service_buf[1024];
 char auth_state_buf[1048576];
+char compression_stats_buf[4096];
+char queue_stats_buf[4096];
+char mailbox_stats_buf[16384];
+char sessions_stats_buf[4096];
+char reconnect_stats_buf[1024];
+char heartbeat_stats_buf[2048];
+char cache_stats_buf[1024];
+
+/**
+ * Decides which client every id uses, see SharedSessions.
+ */
+SharedSessions sessions;
 
 extern "C" based_id Based__new_client(bool enable_tls) {
-    BasedClient* cl = new BasedClient(enable_tls);
     idx++;
 
-    if (clients.find(idx) != clients.end()) {
+    if (sessions.client(idx)) {
         throw std::runtime_error("Ran out of client indices");
     }
 
-    clients[idx] = cl;
+    sessions.add_handle(idx, enable_tls);
 
     return idx;
 }
 
 extern "C" void Based__delete_client(based_id id) {
-    if (clients.find(id) == clients.end()) {
+    if (!sessions.client(id)) {
         std::cerr << "No such id found" << std::endl;
         return;
     }
-    delete clients.at(id);
-    clients.erase(id);
+    sessions.remove_handle(id);
 }
 
 extern "C" char* Based__get_service(based_id client_id,
@@ -39,24 +52,45 @@ extern "C" char* Based__get_service(based_id client_id,
                                     char* key,
                                     bool optional_key,
                                     bool http) {
-    if (clients.find(client_id) == clients.end()) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
         std::cerr << "No such id found" << std::endl;
         return (char*)"";
     }
-    auto cl = clients.at(client_id);
     auto res = cl->discover_service(cluster, org, project, env, name, key, optional_key, http);
     memset(get_service_buf, 0, sizeof get_service_buf);
     strncpy(get_service_buf, res.c_str(), res.length());
     return get_service_buf;
 }
 
+extern "C" int Based__get_service_async(based_id client_id,
+                                       char* cluster,
+                                       char* org,
+                                       char* project,
+                                       char* env,
+                                       char* name,
+                                       char* key,
+                                       bool optional_key,
+                                       bool http,
+                                       void (*cb)(const char*, const char*, int)) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return -1;
+    }
+    return cl->discover_service_async(cluster, org, project, env, name, key, optional_key, http,
+                                      cb);
+}
+
 extern "C" void Based__connect_to_url(based_id client_id, char* url) {
-    if (clients.find(client_id) == clients.end()) {
+    if (!sessions.client(client_id)) {
         std::cerr << "No such id found" << std::endl;
         return;
     }
-    auto cl = clients.at(client_id);
-    cl->_connect_to_url(url);
+    BasedConnectOpt opts;
+    opts.url = url;
+    opts.optional_key = false;
+    sessions.connect(client_id, opts);
 }
 
 extern "C" void Based__connect(based_id client_id,
@@ -69,21 +103,29 @@ extern "C" void Based__connect(based_id client_id,
                                bool optional_key,
                                char* host,
                                char* discovery_url) {
-    if (clients.find(client_id) == clients.end()) {
+    if (!sessions.client(client_id)) {
         std::cerr << "No such id found" << std::endl;
         return;
     }
-    auto cl = clients.at(client_id);
-    cl->connect(cluster, org, project, env, name, key, optional_key, host, discovery_url);
+    BasedConnectOpt opts;
+    opts.cluster = cluster;
+    opts.org = org;
+    opts.project = project;
+    opts.env = env;
+    opts.name = name;
+    opts.key = key;
+    opts.optional_key = optional_key;
+    opts.host = host;
+    opts.discovery_url = discovery_url;
+    sessions.connect(client_id, opts);
 }
 
 extern "C" void Based__disconnect(based_id client_id) {
-    if (clients.find(client_id) == clients.end()) {
+    if (!sessions.client(client_id)) {
         std::cerr << "No such id found" << std::endl;
         return;
     }
-    auto cl = clients.at(client_id);
-    cl->disconnect();
+    sessions.disconnect(client_id);
 }
 
 extern "C" int Based__observe(based_id client_id,
@@ -93,62 +135,72 @@ extern "C" int Based__observe(based_id client_id,
                                * Callback that the observable will trigger.
                                */
                               void (*cb)(const char*, uint64_t, const char*, int)) {
-    if (clients.find(client_id) == clients.end()) {
+    if (!sessions.client(client_id)) {
+        std::cerr << "No such id found" << std::endl;
+        return -1;
+    }
+    return sessions.observe(client_id, name, payload, cb);
+}
+
+extern "C" int Based__observe_patches(
+    based_id client_id,
+    char* name,
+    char* payload,
+    bool keep_value,
+    void (*cb)(const char*, bool, uint64_t, uint64_t, const char*, int)) {
+    if (!sessions.client(client_id)) {
         std::cerr << "No such id found" << std::endl;
         return -1;
     }
-    auto cl = clients.at(client_id);
-    return cl->observe(name, payload, cb);
+    return sessions.observe_patches(client_id, name, payload, keep_value, cb);
 }
 
 extern "C" int Based__get(based_id client_id,
                           char* name,
                           char* payload,
                           void (*cb)(const char*, const char*, int)) {
-    if (clients.find(client_id) == clients.end()) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
         std::cerr << "No such id found" << std::endl;
         return -1;
     }
-    auto cl = clients.at(client_id);
     return cl->get(name, payload, cb);
 }
 
 extern "C" void Based__unobserve(based_id client_id, int sub_id) {
-    if (clients.find(client_id) == clients.end()) {
+    if (!sessions.client(client_id)) {
         std::cerr << "No such id found" << std::endl;
         return;
     }
-    auto cl = clients.at(client_id);
-    cl->unobserve(sub_id);
+    sessions.unobserve(client_id, sub_id);
 }
 
 extern "C" int Based__call(based_id client_id,
                            char* name,
                            char* payload,
                            void (*cb)(const char*, const char*, int)) {
-    if (clients.find(client_id) == clients.end()) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
         std::cerr << "No such id found" << std::endl;
         return -1;
     }
-    auto cl = clients.at(client_id);
     return cl->call(name, payload, cb);
 }
 
 extern "C" void Based__set_auth_state(based_id client_id, char* state, void (*cb)(const char*)) {
-    if (clients.find(client_id) == clients.end()) {
+    if (!sessions.client(client_id)) {
         std::cerr << "No such id found" << std::endl;
         return;
     }
-    auto cl = clients.at(client_id);
-    cl->set_auth_state(state, cb);
+    sessions.set_auth_state(client_id, state, cb);
 }
 
 extern "C" char* Based__get_auth_state(based_id client_id) {
-    if (clients.find(client_id) == clients.end()) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
         std::cerr << "No such id found" << std::endl;
         return (char*)"{}";
     }
-    auto cl = clients.at(client_id);
     auto state = cl->get_auth_state();
     memset(auth_state_buf, 0, sizeof auth_state_buf);
     strncpy(auth_state_buf, state.c_str(), state.length());
@@ -161,31 +213,269 @@ extern "C" int Based__channel_subscribe(based_id client_id,
                                         void (*cb)(const char* /* Data */,
                                                    const char* /* Error */,
                                                    int /*request_id*/)) {
-    if (clients.find(client_id) == clients.end()) {
+    if (!sessions.client(client_id)) {
         std::cerr << "No such id found" << std::endl;
         return -1;
     }
-    auto cl = clients.at(client_id);
-    return cl->channel_subscribe(name, payload, cb);
+    return sessions.channel_subscribe(client_id, name, payload, cb);
 }
 
 extern "C" void Based__channel_unsubscribe(based_id client_id, int id) {
-    if (clients.find(client_id) == clients.end()) {
+    if (!sessions.client(client_id)) {
         std::cerr << "No such id found" << std::endl;
         return;
     }
-    auto cl = clients.at(client_id);
-    cl->channel_unsubscribe(id);
+    sessions.channel_unsubscribe(client_id, id);
 }
 
 extern "C" void Based__channel_publish(based_id client_id,
                                        char* name,
                                        char* payload,
                                        char* message) {
-    if (clients.find(client_id) == clients.end()) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
         std::cerr << "No such id found" << std::endl;
         return;
     }
-    auto cl = clients.at(client_id);
     cl->channel_publish(name, payload, message);
+}
+
+extern "C" void Based__flush(based_id client_id) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return;
+    }
+    cl->flush();
+}
+
+extern "C" void Based__set_flush_options(based_id client_id,
+                                         uint32_t window_us,
+                                         uint32_t max_bytes) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return;
+    }
+    cl->set_flush_options(window_us, max_bytes);
+}
+
+extern "C" void Based__set_compression_options(based_id client_id,
+                                               uint32_t threshold,
+                                               int32_t level,
+                                               double min_ratio) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return;
+    }
+    if (level < -1 || level > 9) {
+        std::cerr << "No such compression level " << level << std::endl;
+        return;
+    }
+    if (!(min_ratio >= 0)) {
+        std::cerr << "Invalid compression ratio " << min_ratio << std::endl;
+        return;
+    }
+    cl->set_compression_options(threshold, level, min_ratio);
+}
+
+extern "C" char* Based__get_compression_stats(based_id client_id) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return (char*)"{}";
+    }
+    auto stats = cl->get_compression_stats();
+    memset(compression_stats_buf, 0, sizeof compression_stats_buf);
+    strncpy(compression_stats_buf, stats.c_str(), sizeof compression_stats_buf - 1);
+    return compression_stats_buf;
+}
+
+extern "C" void Based__set_queue_limits(based_id client_id,
+                                        int type,
+                                        uint32_t max_messages,
+                                        uint32_t max_bytes,
+                                        int overflow_policy) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return;
+    }
+    if (type < OutgoingType::FUNCTION || type > OutgoingType::CHANNEL_UNSUBSCRIBE) {
+        std::cerr << "No such request type " << type << std::endl;
+        return;
+    }
+    if (overflow_policy < OverflowPolicy::BLOCK || overflow_policy > OverflowPolicy::FAIL) {
+        std::cerr << "No such overflow policy " << overflow_policy << std::endl;
+        return;
+    }
+    cl->set_queue_limits((OutgoingType)type, max_messages, max_bytes,
+                         (OverflowPolicy)overflow_policy);
+}
+
+extern "C" void Based__set_max_buffered_amount(based_id client_id, uint32_t max_bytes) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return;
+    }
+    cl->set_max_buffered_amount(max_bytes);
+}
+
+extern "C" char* Based__get_queue_stats(based_id client_id) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return (char*)"{}";
+    }
+    auto stats = cl->get_queue_stats();
+    memset(queue_stats_buf, 0, sizeof queue_stats_buf);
+    strncpy(queue_stats_buf, stats.c_str(), sizeof queue_stats_buf - 1);
+    return queue_stats_buf;
+}
+
+extern "C" void Based__set_dispatcher_threads(based_id client_id, uint32_t threads) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return;
+    }
+    cl->set_dispatcher_threads(threads);
+}
+
+extern "C" void Based__set_mailbox_options(based_id client_id,
+                                           int sub_id,
+                                           uint32_t capacity,
+                                           int policy) {
+    if (!sessions.client(client_id)) {
+        std::cerr << "No such id found" << std::endl;
+        return;
+    }
+    if (policy < MailboxPolicy::CONFLATE || policy > MailboxPolicy::DROP) {
+        std::cerr << "No such mailbox policy " << policy << std::endl;
+        return;
+    }
+    sessions.set_mailbox_options(client_id, sub_id, capacity, (MailboxPolicy)policy);
+}
+
+extern "C" char* Based__get_mailbox_stats(based_id client_id) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return NULL;
+    }
+    auto stats = cl->get_mailbox_stats();
+    memset(mailbox_stats_buf, 0, sizeof mailbox_stats_buf);
+    strncpy(mailbox_stats_buf, stats.c_str(), sizeof mailbox_stats_buf - 1);
+    return mailbox_stats_buf;
+}
+
+extern "C" void Based__set_hub_reevaluation(based_id client_id, uint32_t interval_ms) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return;
+    }
+    cl->set_hub_reevaluation(interval_ms);
+}
+
+extern "C" void Based__set_reconnect_options(based_id client_id,
+                                             uint32_t base_ms,
+                                             double multiplier,
+                                             uint32_t max_ms) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return;
+    }
+    cl->set_reconnect_options(base_ms, multiplier, max_ms);
+}
+
+extern "C" char* Based__get_reconnect_stats(based_id client_id) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return (char*)"{}";
+    }
+    auto stats = cl->get_reconnect_stats();
+    memset(reconnect_stats_buf, 0, sizeof reconnect_stats_buf);
+    strncpy(reconnect_stats_buf, stats.c_str(), sizeof reconnect_stats_buf - 1);
+    return reconnect_stats_buf;
+}
+
+extern "C" void Based__set_heartbeat(based_id client_id,
+                                     uint32_t interval_ms,
+                                     uint32_t max_missed_pongs) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return;
+    }
+    cl->set_heartbeat(interval_ms, max_missed_pongs);
+}
+
+extern "C" char* Based__get_heartbeat_stats(based_id client_id) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return (char*)"{}";
+    }
+    auto stats = cl->get_heartbeat_stats();
+    memset(heartbeat_stats_buf, 0, sizeof heartbeat_stats_buf);
+    strncpy(heartbeat_stats_buf, stats.c_str(), sizeof heartbeat_stats_buf - 1);
+    return heartbeat_stats_buf;
+}
+
+extern "C" void Based__set_standby(based_id client_id, bool enabled) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return;
+    }
+    cl->set_standby(enabled);
+}
+
+extern "C" void Based__set_cache_budget(based_id client_id, uint64_t bytes) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return;
+    }
+    cl->set_cache_budget(bytes);
+}
+
+extern "C" char* Based__get_cache_stats(based_id client_id) {
+    auto cl = sessions.client(client_id);
+    if (!cl) {
+        std::cerr << "No such id found" << std::endl;
+        return (char*)"{}";
+    }
+    auto stats = cl->get_cache_stats();
+    memset(cache_stats_buf, 0, sizeof cache_stats_buf);
+    strncpy(cache_stats_buf, stats.c_str(), sizeof cache_stats_buf - 1);
+    return cache_stats_buf;
+}
+
+extern "C" void Based__set_persistent_cache(char* path) {
+    PersistentCache::get().configure(path ? path : "");
+}
+
+extern "C" void Based__set_io_threads(uint32_t threads) {
+    IoPool::set_size(threads);
+}
+
+extern "C" void Based__set_connection_sharing(bool enabled) {
+    sessions.set_enabled(enabled);
+}
+
+extern "C" char* Based__get_sessions_stats() {
+    auto stats = sessions.stats();
+    memset(sessions_stats_buf, 0, sizeof sessions_stats_buf);
+    strncpy(sessions_stats_buf, stats.c_str(), sizeof sessions_stats_buf - 1);
+    return sessions_stats_buf;
+}
+
+extern "C" void Based__set_discovery_cache(char* path, uint32_t ttl_seconds) {
+    DiscoveryCache::get().configure(path ? path : "", ttl_seconds);
 }
\ No newline at end of file
@@ -1,12 +1,19 @@
+#include <future>
 #include <json.hpp>
 #include <stdexcept>
 #include <utility>
 
 #include "apply-patch.hpp"
+#include "persistentcache.hpp"
 #include "utility.hpp"
 
 #include "basedclient.hpp"
 
+/**
+ * Observables that change often are written to the PersistentCache at most this often, in ms.
+ */
+#define BASED_PERSIST_INTERVAL_MS 1000
+
 using namespace nlohmann::literals;
 
 enum IncomingType {
@@ -20,11 +27,69 @@ enum IncomingType {
     CHANNEL_MESSAGE = 7,
 };
 
+std::atomic<sub_id_t> BasedClient::s_sub_id(0);
+
 BasedClient::BasedClient(bool enable_tls)
-    : m_request_id(0),
-      m_sub_id(0),
+    : m_con(enable_tls),
+      m_request_id(0),
       m_auth_in_progress(false),
-      m_con(enable_tls){};
+      m_persist_scheduled(false),
+      m_persist_timer(m_con.get_io_service()),
+      m_queued_bytes(0),
+      m_flush_window_us(0),
+      m_flush_max_bytes(65536),
+      m_flush_scheduled(false),
+      m_flush_timer(m_con.get_io_service()),
+      m_max_buffered_amount(4 * 1024 * 1024),
+      m_commands_scheduled(false),
+      m_auth_state_snapshot(std::make_shared<const std::string>()),
+      m_alive(std::make_shared<bool>(true)) {
+    // The handlers are set once, the connection calls them on the io thread.
+    m_con.set_message_handler([&](const std::string& msg) { on_message(msg); });
+    m_con.set_open_handler([&]() { on_open(); });
+    m_con.set_standby_open_handler([&]() { on_standby_open(); });
+};
+
+BasedClient::~BasedClient() {
+    // The io thread outlives the client, so it must be done with it before the members go away.
+    // This runs after every command posted before it, and once it's done the connection doesn't
+    // call back into the client anymore.
+    std::promise<void> done;
+    auto caller = std::this_thread::get_id();
+    post([&, caller]() {
+        m_con.set_message_handler(nullptr);
+        m_con.set_open_handler(nullptr);
+        m_con.set_standby_open_handler(nullptr);
+        m_flush_timer.cancel();
+        // The last values are written now, the next start begins with them
+        m_persist_timer.cancel();
+        persist();
+        // A session that's released can still have calls and gets of a handle that moved away,
+        // they get an error instead of no answer. The replies already queued still run.
+        fail_pending();
+        if (m_oneshot_mailbox) {
+            for (auto& message : m_oneshot_mailbox->take()) message();
+        }
+        m_sub_mailboxes.clear();
+        m_oneshot_mailbox = nullptr;
+        if (m_dispatcher && m_dispatcher->owns_thread(caller)) {
+            // Deleted from a callback, its thread is waiting on this one and can't be joined.
+            Dispatcher::release(std::move(m_dispatcher));
+        }
+        m_dispatcher.reset();
+        done.set_value();
+    });
+    if (m_con.on_io_thread()) {
+        // deleted from one of its own callbacks, the command can't run before this returns
+        run_commands();
+    }
+    done.get_future().wait();
+    m_alive.reset();
+
+    for (auto& el : m_active_observables) delete el.second;
+    for (auto& el : m_active_channels) delete el.second;
+    for (auto& el : m_active_publish_channels) delete el.second;
+}
 
 /////////////////
 // Helper functions
@@ -47,10 +112,27 @@ inline obs_id_t make_obs_id(std::string& name, std::string& payload) {
     return obs_id;
 }
 
+/**
+ * Copy the payload out of the frame, inflating it if it's compressed. This is the only copy made
+ * of received data, the callbacks need a null terminated string anyway.
+ */
+inline std::string read_payload(const FrameView& payload, int32_t is_deflate) {
+    if (is_deflate) {
+        return Utility::inflate_string(payload.data(), payload.size());
+    }
+    return payload.to_string();
+}
+
 //////////////////////////////////////////////////////////////////////////
 ///////////////////////// Client methods /////////////////////////////////
 //////////////////////////////////////////////////////////////////////////
 
+/**
+ * Discovery requests made for get_service give up after this many failures, connections retry
+ * until they get a hub.
+ */
+#define BASED_DISCOVERY_MAX_ATTEMPTS 10
+
 std::string BasedClient::discover_service(std::string cluster,
                                           std::string org,
                                           std::string project,
@@ -59,8 +141,6 @@ std::string BasedClient::discover_service(std::string cluster,
                                           std::string key,
                                           bool optional_key,
                                           bool html) {
-    // TODO: This is currently blocking (no bueno), should be changed.
-    // Especially for bad connections
     BasedConnectOpt opts = {
         .cluster = cluster,
         .org = org,
@@ -71,13 +151,56 @@ std::string BasedClient::discover_service(std::string cluster,
         .optional_key = optional_key,
     };
 
-    std::string url = m_con.discover_service(opts, html);
-    return url;
+    if (m_con.on_io_thread()) {
+        // the request is made by the io thread, it can't wait for itself
+        BASED_LOG("discover_service can't be called from a callback, use discover_service_async");
+        return "";
+    }
+
+    std::promise<std::string> url;
+    m_con.discover_service(opts, html, BASED_DISCOVERY_MAX_ATTEMPTS,
+                           [&url](const std::string& res, const std::string& error) {
+                               if (!error.empty()) BASED_LOG("%s", error.c_str());
+                               url.set_value(res);
+                           });
+    return url.get_future().get();
+}
+
+int BasedClient::discover_service_async(std::string cluster,
+                                        std::string org,
+                                        std::string project,
+                                        std::string env,
+                                        std::string name,
+                                        std::string key,
+                                        bool optional_key,
+                                        bool html,
+                                        void (*cb)(const char* /*url*/,
+                                                   const char* /*error*/,
+                                                   int /*request_id*/)) {
+    BasedConnectOpt opts = {
+        .cluster = cluster,
+        .org = org,
+        .project = project,
+        .env = env,
+        .name = name.empty() ? "@based/env-hub" : name,
+        .key = key,
+        .optional_key = optional_key,
+    };
+
+    int id = s_sub_id++;
+    std::weak_ptr<bool> alive = m_alive;
+    m_con.discover_service(opts, html, BASED_DISCOVERY_MAX_ATTEMPTS,
+                           [this, alive, cb, id](const std::string& url, const std::string& error) {
+                               if (alive.expired()) return;
+                               dispatch([cb, url, error, id]() {
+                                   cb(url.c_str(), error.c_str(), id);
+                               });
+                           });
+    return id;
 }
 
 void BasedClient::_connect_to_url(std::string url) {
-    m_con.set_message_handler([&](std::string msg) { on_message(msg); });
-    m_con.set_open_handler([&]() { on_open(); });
+    post([this, url]() { m_env_key = url; });
     m_con.connect_to_uri(url);
 }
 
@@ -90,8 +213,8 @@ void BasedClient::connect(std::string cluster,
                           bool optional_key,
                           std::string host,
                           std::string discovery_url) {
-    m_con.set_message_handler([&](std::string msg) { on_message(msg); });
-    m_con.set_open_handler([&]() { on_open(); });
+    json env_key = {cluster, org, project, env, name, host};
+    post([this, env_key]() { m_env_key = env_key.dump(); });
     m_con.connect(cluster, org, project, env, key, optional_key, host, discovery_url);
 }
 
@@ -119,145 +242,237 @@ int BasedClient::observe(std::string name,
      * and the unobserve request should be queued, to let the server know.
      */
 
+    auto sub_id = s_sub_id++;
+    add_observer(sub_id, name, payload, cb);
+    return sub_id;
+}
+
+void BasedClient::add_observer(sub_id_t sub_id,
+                               std::string name,
+                               std::string payload,
+                               void (*cb)(const char*, checksum_t, const char*, int)) {
     auto obs_id = make_obs_id(name, payload);
-    auto sub_id = m_sub_id++;
 
-    if (m_active_observables.find(obs_id) == m_active_observables.end()) {
-        // first time this query is observed
-        // encode request
-        checksum_t checksum = 0;
+    post([this, obs_id, sub_id, name, payload, cb]() {
+        // add cb for this sub
+        m_sub_callback[sub_id] = cb;
+
+        add_subscriber(obs_id, sub_id, name, payload);
 
-        if (m_cache.find(obs_id) != m_cache.end()) {
+        if (auto entry = current_value(obs_id)) {
             // if cache for this obs exists
-            checksum = m_cache.at(obs_id).second;
+            auto data = entry->value();
+            checksum_t checksum = entry->checksum;
+            dispatch(sub_id, [cb, data, checksum, sub_id]() {
+                cb(data->c_str(), checksum, "", sub_id);
+            });
         }
+    });
+}
 
-        std::vector<uint8_t> msg = Utility::encode_observe_message(obs_id, name, payload, checksum);
+int BasedClient::observe_patches(std::string name,
+                                 std::string payload,
+                                 bool keep_value,
+                                 void (*cb)(const char* /*data or patch*/,
+                                            bool /*is_patch*/,
+                                            checksum_t /*checksum*/,
+                                            checksum_t /*prev_checksum*/,
+                                            const char* /*error*/,
+                                            int /*sub_id*/)) {
+    auto sub_id = s_sub_id++;
+    add_patch_observer(sub_id, name, payload, keep_value, cb);
+    return sub_id;
+}
 
-        // add encoded request to queue
-        m_observe_queue.push_back(msg);
+void BasedClient::add_patch_observer(
+    sub_id_t sub_id,
+    std::string name,
+    std::string payload,
+    bool keep_value,
+    void (*cb)(const char*, bool, checksum_t, checksum_t, const char*, int)) {
+    auto obs_id = make_obs_id(name, payload);
+
+    post([this, obs_id, sub_id, name, payload, keep_value, cb]() {
+        m_patch_callbacks[sub_id] = {cb, keep_value};
+
+        add_subscriber(obs_id, sub_id, name, payload);
+
+        // The patches that follow apply to this value
+        if (auto entry = current_value(obs_id)) {
+            auto data = entry->value();
+            checksum_t checksum = entry->checksum;
+            dispatch(sub_id, [cb, data, checksum, sub_id]() {
+                cb(data->c_str(), false, checksum, 0, "", sub_id);
+            });
+        }
+    });
+}
+
+void BasedClient::add_subscriber(obs_id_t obs_id,
+                                 sub_id_t sub_id,
+                                 std::string name,
+                                 std::string payload) {
+    if (m_active_observables.find(obs_id) == m_active_observables.end()) {
+        // Start from the value of the last run, if there is one, and subscribe with its
+        // checksum so the server only sends something if it changed.
+        std::string value;
+        checksum_t checksum;
+        if (!m_cache.find(obs_id) && !m_env_key.empty() &&
+            PersistentCache::get().lookup(m_env_key, obs_id, value, checksum)) {
+            m_cache.put(obs_id, std::make_shared<const std::string>(std::move(value)), checksum);
+        }
+
+        // first time this query is observed, queue the request. It's encoded on drain, with
+        // the checksum of the cache at that moment.
+        enqueue(OutgoingType::SUBSCRIBE, {obs_id});
 
-        // add encoded request to map of observables
+        // add request to map of observables
         m_active_observables[obs_id] = new Observable(name, payload);
+        m_cache.pin(obs_id);
 
         // add subscriber to list of subs for this observable
         m_obs_to_subs[obs_id] = std::set<sub_id_t>{sub_id};
 
-        // record what obs this sub is for, to delete it later
-        m_sub_to_obs[sub_id] = obs_id;
-
-        // add cb for this sub
-        m_sub_callback[sub_id] = cb;
-
-        drain_queues();
+        schedule_flush();
     } else {
         // this query has already been requested once, only add subscriber,
         // dont send a new request.
-
-        // add subscriber to that observable
         m_obs_to_subs.at(obs_id).insert(sub_id);
+    }
 
-        // record what obs this sub is for, to delete it later
-        m_sub_to_obs[sub_id] = obs_id;
+    // record what obs this sub is for, to delete it later
+    m_sub_to_obs[sub_id] = obs_id;
+}
 
-        // add cb for this new sub
-        m_sub_callback[sub_id] = cb;
+ObservableCache::Entry* BasedClient::current_value(obs_id_t obs_id) {
+    if (m_unpatched.find(obs_id) != m_unpatched.end()) {
+        request_full_data(obs_id);
+        return nullptr;
+    }
+    return m_cache.find(obs_id);
+}
 
-        if (m_cache.find(obs_id) != m_cache.end()) {
-            // if cache for this obs exists
-            cb(m_cache.at(obs_id).first.c_str(), m_cache.at(obs_id).second, "", sub_id);
+bool BasedClient::needs_value(obs_id_t obs_id) {
+    auto gets = m_obs_to_gets.find(obs_id);
+    if (gets != m_obs_to_gets.end() && !gets->second.empty()) return true;
+
+    auto subs = m_obs_to_subs.find(obs_id);
+    if (subs == m_obs_to_subs.end()) return false;
+    for (auto sub_id : subs->second) {
+        auto patch_observer = m_patch_callbacks.find(sub_id);
+        if (patch_observer == m_patch_callbacks.end() || patch_observer->second.keep_value) {
+            return true;
         }
     }
-
-    return sub_id;
+    return false;
 }
 
 int BasedClient::get(std::string name,
                      std::string payload,
                      void (*cb)(const char* /*data*/, const char* /*error*/, int /*sub_id*/)) {
     auto obs_id = make_obs_id(name, payload);
-    auto sub_id = m_sub_id++;
+    auto sub_id = s_sub_id++;
+    wait_for_room(OutgoingType::GET);
 
-    if (m_obs_to_gets.find(obs_id) != m_obs_to_gets.end()) {
+    post([this, obs_id, sub_id, name, payload, cb]() {
+        // The cached value must not be evicted while the server may answer with "unchanged"
+        if (m_obs_to_gets[obs_id].empty()) m_cache.pin(obs_id);
         m_obs_to_gets.at(obs_id).insert(sub_id);
-    } else {
-        m_obs_to_gets[obs_id] = std::set<sub_id_t>{sub_id};
-    }
-    m_get_sub_callbacks[sub_id] = cb;
-
-    if (m_active_observables.find(obs_id) == m_active_observables.end()) {
-        checksum_t checksum = 0;
-
-        if (m_cache.find(obs_id) != m_cache.end()) {
-            // if cache for this obs exists
-            checksum = m_cache.at(obs_id).second;
+        m_get_sub_callbacks[sub_id] = cb;
+
+        if (m_active_observables.find(obs_id) == m_active_observables.end()) {
+            enqueue(OutgoingType::GET, {obs_id, name, payload});
+            schedule_flush();
+        } else if (m_unpatched.find(obs_id) != m_unpatched.end()) {
+            // the cached value is behind, it's answered with the full value
+            request_full_data(obs_id);
         }
-        std::vector<uint8_t> msg = Utility::encode_get_message(obs_id, name, payload, checksum);
-        m_get_queue.push_back(msg);
-        drain_queues();
-    }
+    });
 
     return sub_id;
 }
 
 void BasedClient::unobserve(int sub_id) {
-    if (m_sub_to_obs.find(sub_id) == m_sub_to_obs.end()) {
-        BASED_LOG("No subscription found with sub_id %d", sub_id);
-        return;
-    }
-    auto obs_id = m_sub_to_obs.at(sub_id);
-
-    // remove sub from list of subs for that observable
-    m_obs_to_subs.at(obs_id).erase(sub_id);
-
-    // remove on_data callback
-    m_sub_callback.erase(sub_id);
-
-    // remove sub to obs mapping for removed sub
-    m_sub_to_obs.erase(sub_id);
-
-    // if the list is now empty, add request to unobserve to queue
-    if (m_obs_to_subs.at(obs_id).empty()) {
-        std::vector<uint8_t> msg = Utility::encode_unobserve_message(obs_id);
-        m_unobserve_queue.push_back(msg);
-        // and remove the obs from the map of active ones.
-        delete m_active_observables.at(obs_id);
-        m_active_observables.erase(obs_id);
-        // and the vector of listeners, since it's now empty we can free the memory
-        m_obs_to_subs.erase(obs_id);
-    }
-    drain_queues();
+    post([this, sub_id]() {
+        if (m_sub_to_obs.find(sub_id) == m_sub_to_obs.end()) {
+            BASED_LOG("No subscription found with sub_id %d", sub_id);
+            return;
+        }
+        auto obs_id = m_sub_to_obs.at(sub_id);
+
+        // remove sub from list of subs for that observable
+        m_obs_to_subs.at(obs_id).erase(sub_id);
+
+        // remove on_data callback
+        m_sub_callback.erase(sub_id);
+        m_patch_callbacks.erase(sub_id);
+        close_mailbox(sub_id);
+
+        // remove sub to obs mapping for removed sub
+        m_sub_to_obs.erase(sub_id);
+
+        // if the list is now empty, add request to unobserve to queue
+        if (m_obs_to_subs.at(obs_id).empty()) {
+            enqueue(OutgoingType::UNSUBSCRIBE, {obs_id});
+            // and remove the obs from the map of active ones.
+            delete m_active_observables.at(obs_id);
+            m_active_observables.erase(obs_id);
+            // the value stays cached, until it's evicted
+            m_cache.unpin(obs_id);
+            m_unpatched.erase(obs_id);
+            // and the vector of listeners, since it's now empty we can free the memory
+            m_obs_to_subs.erase(obs_id);
+        }
+        schedule_flush();
+    });
 }
 
 int BasedClient::call(std::string name,
                       std::string payload,
                       void (*cb)(const char* /*data*/, const char* /*error*/, int /*request_id*/)) {
-    m_request_id++;
-    if (m_request_id > 16777215) {
-        m_request_id = 0;
-    }
-    auto id = m_request_id;
-    m_call_callbacks[id] = cb;
-    // encode the message
-    std::vector<uint8_t> msg = Utility::encode_function_message(id, name, payload);
-    m_function_queue.push_back(msg);
-    drain_queues();
-    return m_request_id;
+    // ids are 3 bytes in the protocol, they wrap around
+    req_id_t id = m_request_id;
+    req_id_t next;
+    do {
+        next = id >= 16777215 ? 0 : id + 1;
+    } while (!m_request_id.compare_exchange_weak(id, next));
+    id = next;
+
+    wait_for_room(OutgoingType::FUNCTION);
+
+    post([this, id, name, payload, cb]() {
+        m_call_callbacks[id] = cb;
+        enqueue(OutgoingType::FUNCTION, {id, name, payload});
+        schedule_flush();
+    });
+    return id;
 }
 
 void BasedClient::set_auth_state(std::string state, void (*cb)(const char*)) {
+    post([this, state, cb]() { queue_auth(state, cb); });
+}
+
+void BasedClient::queue_auth(const std::string& state, void (*cb)(const char*)) {
     if (m_auth_in_progress) return;
 
     m_auth_request_state = state;
     m_auth_in_progress = true;
     m_auth_callback = cb;
 
-    m_auth_queue = Utility::encode_auth_message(state);
-    drain_queues();
+    {
+        // only the latest auth state is relevant
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_queued_bytes -= m_auth_queue.bytes;
+        m_auth_queue.clear();
+    }
+    QueuedRequest req;
+    req.payload = state;
+    enqueue(OutgoingType::AUTH, req);
+    schedule_flush();
 }
 
 std::string BasedClient::get_auth_state() {
-    return m_auth_state;
+    return *std::atomic_load(&m_auth_state_snapshot);
 }
 
 int BasedClient::channel_subscribe(std::string name,
@@ -265,314 +480,927 @@ int BasedClient::channel_subscribe(std::string name,
                                    void (*cb)(const char* /*data*/,
                                               const char* /*error*/,
                                               int /*sub_id*/)) {
-    auto obs_id = make_obs_id(name, payload);
-    auto sub_id = m_sub_id++;
+    auto sub_id = s_sub_id++;
+    add_channel_subscriber(sub_id, name, payload, cb);
+    return sub_id;
+}
 
-    if (m_active_channels.find(obs_id) == m_active_channels.end()) {
-        // first time this channel is observed
+void BasedClient::add_channel_subscriber(sub_id_t sub_id,
+                                         std::string name,
+                                         std::string payload,
+                                         void (*cb)(const char*, const char*, int)) {
+    auto obs_id = make_obs_id(name, payload);
 
-        std::vector<uint8_t> msg =
-            Utility::encode_subscribe_channel_message(obs_id, name, payload, false);
+    post([this, obs_id, sub_id, name, payload, cb]() {
+        if (m_active_channels.find(obs_id) == m_active_channels.end()) {
+            // first time this channel is observed
 
-        m_channel_sub_queue.push_back(msg);
+            enqueue(OutgoingType::CHANNEL_SUBSCRIBE, {obs_id, name, payload});
 
-        m_active_channels[obs_id] = new Observable(name, payload);
+            m_active_channels[obs_id] = new Observable(name, payload);
 
-        m_channel_to_subs[obs_id] = std::set<sub_id_t>{sub_id};
+            m_channel_to_subs[obs_id] = std::set<sub_id_t>{sub_id};
 
-        m_sub_to_channel[sub_id] = obs_id;
+            m_sub_to_channel[sub_id] = obs_id;
 
-        m_channel_callback[sub_id] = cb;
-    } else {
-        // this query has already been requested once, only add subscriber,
-        // dont send a new request.
+            m_channel_callback[sub_id] = cb;
+        } else {
+            // this query has already been requested once, only add subscriber,
+            // dont send a new request.
 
-        m_channel_to_subs.at(obs_id).insert(sub_id);
+            m_channel_to_subs.at(obs_id).insert(sub_id);
 
-        m_sub_to_channel[sub_id] = obs_id;
+            m_sub_to_channel[sub_id] = obs_id;
 
-        m_channel_callback[sub_id] = cb;
-    }
-
-    drain_queues();
+            m_channel_callback[sub_id] = cb;
+        }
 
-    return sub_id;
+        schedule_flush();
+    });
 }
 
 void BasedClient::channel_publish(std::string name, std::string payload, std::string message) {
     auto obs_id = make_obs_id(name, payload);
+    wait_for_room(OutgoingType::CHANNEL_PUBLISH);
 
-    if (m_active_publish_channels.find(obs_id) == m_active_publish_channels.end()) {
-        m_active_publish_channels[obs_id] = new Observable(name, payload);
-    }
-
-    std::vector<uint8_t> msg = Utility::encode_publish_channel_message(obs_id, message);
+    post([this, obs_id, name, payload, message]() {
+        if (m_active_publish_channels.find(obs_id) == m_active_publish_channels.end()) {
+            m_active_publish_channels[obs_id] = new Observable(name, payload);
+        }
 
-    m_channel_publish_queue.push_back(msg);
+        QueuedRequest req;
+        req.id = obs_id;
+        req.payload = message;
+        enqueue(OutgoingType::CHANNEL_PUBLISH, req);
 
-    drain_queues();
+        schedule_flush();
+    });
 }
 
 void BasedClient::channel_unsubscribe(int sub_id) {
-    if (m_sub_to_channel.find(sub_id) == m_sub_to_channel.end()) {
-        BASED_LOG("No channel_subscription found with sub_id %d", sub_id);
-        return;
-    }
-    auto obs_id = m_sub_to_channel.at(sub_id);
+    post([this, sub_id]() {
+        if (m_sub_to_channel.find(sub_id) == m_sub_to_channel.end()) {
+            BASED_LOG("No channel_subscription found with sub_id %d", sub_id);
+            return;
+        }
+        auto obs_id = m_sub_to_channel.at(sub_id);
 
-    // remove sub from list of subs for that observable
-    m_channel_to_subs.at(obs_id).erase(sub_id);
+        // remove sub from list of subs for that observable
+        m_channel_to_subs.at(obs_id).erase(sub_id);
 
-    // remove on_data callback
-    m_sub_callback.erase(sub_id);
+        // remove on_data callback
+        m_channel_callback.erase(sub_id);
+        close_mailbox(sub_id);
 
-    // remove sub to obs mapping for removed sub
-    m_sub_to_channel.erase(sub_id);
+        // remove sub to obs mapping for removed sub
+        m_sub_to_channel.erase(sub_id);
 
-    if (m_channel_to_subs.at(obs_id).empty()) {
-        std::vector<uint8_t> msg = Utility::encode_unsubscribe_channel_message(obs_id);
-        m_unobserve_queue.push_back(msg);
-        // and remove the obs from the map of active ones.
-        delete m_active_channels.at(obs_id);
-        m_active_channels.erase(obs_id);
-        // and the vector of listeners, since it's now empty we can free the memory
-        m_channel_to_subs.erase(obs_id);
-    }
-    drain_queues();
+        if (m_channel_to_subs.at(obs_id).empty()) {
+            enqueue(OutgoingType::CHANNEL_UNSUBSCRIBE, {obs_id});
+            // and remove the obs from the map of active ones.
+            delete m_active_channels.at(obs_id);
+            m_active_channels.erase(obs_id);
+            // and the vector of listeners, since it's now empty we can free the memory
+            m_channel_to_subs.erase(obs_id);
+        }
+        schedule_flush();
+    });
 }
 
 /////////////////////////////////////////////////////////////
 /////////////////// End of client methods ///////////////////
 /////////////////////////////////////////////////////////////
 
-void BasedClient::drain_queues() {
-    if (m_con.status() != ConnectionStatus::OPEN) {
-        // std::cerr << "Connection is unavailable, status = " << m_con.status() << std::endl;
-        return;
-    }
-
-    std::vector<uint8_t> buff;
+void BasedClient::flush() {
+    post([this]() { drain_queues(); });
+}
 
-    if (!m_auth_queue.empty()) {
-        buff.insert(buff.end(), m_auth_queue.begin(), m_auth_queue.end());
-        m_auth_queue.clear();
+void BasedClient::post(std::function<void()> command) {
+    m_commands.push(std::move(command));
+    // Only the first command after a run schedules the next one, the rest piggyback on it.
+    if (!m_commands_scheduled.exchange(true)) {
+        std::weak_ptr<bool> alive = m_alive;
+        m_con.get_io_service().post([this, alive]() {
+            if (alive.expired()) return;
+            run_commands();
+        });
     }
+}
 
-    if (!m_channel_sub_queue.empty()) {
-        for (auto msg : m_channel_sub_queue) {
-            buff.insert(buff.end(), msg.begin(), msg.end());
+void BasedClient::run_commands() {
+    // Reset before popping: a command pushed from now on schedules a new run, one pushed before
+    // is popped by this one.
+    m_commands_scheduled = false;
+
+    std::function<void()> command;
+    while (m_commands.pop(command)) {
+        try {
+            command();
+        } catch (std::exception& e) {
+            BASED_LOG("Exception in client command: %s", e.what());
         }
-        m_channel_sub_queue.clear();
     }
+}
+
+void BasedClient::wait_for_room(OutgoingType type) {
+    if (m_con.on_io_thread()) return;
+
+    std::unique_lock<std::mutex> lock(m_queue_mutex);
+    RequestQueue& queue = queue_for(type);
+    if (queue.policy != OverflowPolicy::BLOCK || queue.fits({})) return;
+
+    queue.blocked++;
+    m_queue_drained.wait(lock, [&]() {
+        return queue.policy != OverflowPolicy::BLOCK || queue.fits({});
+    });
+}
+
+void BasedClient::set_dispatcher_threads(size_t threads) {
+    post([this, threads]() {
+        // The mailboxes belong to the old dispatcher, what they didn't run yet moves over to the
+        // new ones, so no reply or value is lost.
+        std::map<sub_id_t, std::deque<std::function<void()>>> pending;
+        for (auto& el : m_sub_mailboxes) {
+            pending[el.first] = el.second->take();
+        }
+        m_sub_mailboxes.clear();
+        std::deque<std::function<void()>> oneshots;
+        if (m_oneshot_mailbox) oneshots = m_oneshot_mailbox->take();
+        m_oneshot_mailbox = nullptr;
+
+        // Callbacks that are running are waited for on another thread, not the io thread.
+        Dispatcher::release(std::move(m_dispatcher));
+        if (threads) m_dispatcher.reset(new Dispatcher(threads));
+
+        for (auto& el : pending) {
+            for (auto& message : el.second) dispatch(el.first, std::move(message));
+        }
+        for (auto& message : oneshots) dispatch(std::move(message));
+    });
+}
+
+void BasedClient::set_mailbox_options(int sub_id, size_t capacity, MailboxPolicy policy) {
+    post([this, sub_id, capacity, policy]() {
+        MailboxOptions opts;
+        opts.capacity = capacity;
+        opts.policy = policy;
+        if (sub_id < 0) {
+            m_mailbox_options = opts;
+            return;
+        }
+        // Recreated with the new options on the next message
+        close_mailbox(sub_id);
+        m_sub_mailbox_options[sub_id] = opts;
+    });
+}
+
+std::string BasedClient::get_mailbox_stats() {
+    // The mailboxes belong to the io thread
+    auto collect = [this]() {
+        json subs = json::object();
+        // Options set for a mailbox that doesn't exist yet are the ones it will get
+        for (auto& el : m_sub_mailbox_options) {
+            subs[std::to_string(el.first)] = {{"capacity", el.second.capacity},
+                                              {"policy", (int)el.second.policy},
+                                              {"dropped", 0}};
+        }
+        for (auto& el : m_sub_mailboxes) {
+            const MailboxOptions& opts = el.second->options();
+            subs[std::to_string(el.first)] = {{"capacity", opts.capacity},
+                                              {"policy", (int)opts.policy},
+                                              {"dropped", el.second->dropped()}};
+        }
+
+        json res = {{"capacity", m_mailbox_options.capacity},
+                    {"policy", (int)m_mailbox_options.policy},
+                    {"subscriptions", subs}};
+        return res.dump();
+    };
+
+    if (m_con.on_io_thread()) return collect();
+    std::promise<std::string> stats;
+    post([&]() { stats.set_value(collect()); });
+    return stats.get_future().get();
+}
+
+void BasedClient::set_hub_reevaluation(uint32_t interval_ms) {
+    m_con.set_hub_reevaluation(interval_ms);
+}
+
+void BasedClient::set_reconnect_options(uint32_t base_ms, double multiplier, uint32_t max_ms) {
+    m_con.set_reconnect_options(base_ms, multiplier, max_ms);
+}
+
+std::string BasedClient::get_reconnect_stats() {
+    return m_con.reconnect_stats();
+}
+
+void BasedClient::set_heartbeat(uint32_t interval_ms, uint32_t max_missed) {
+    m_con.set_heartbeat(interval_ms, max_missed);
+}
+
+std::string BasedClient::get_heartbeat_stats() {
+    return m_con.heartbeat_stats();
+}
+
+void BasedClient::set_standby(bool enabled) {
+    m_con.set_standby(enabled);
+}
 
-    if (!m_channel_unsub_queue.empty()) {
-        for (auto msg : m_channel_unsub_queue) {
-            buff.insert(buff.end(), msg.begin(), msg.end());
+void BasedClient::set_cache_budget(size_t bytes) {
+    post([this, bytes]() { m_cache.set_budget(bytes); });
+}
+
+std::string BasedClient::get_cache_stats() {
+    return m_cache.stats();
+}
+
+void BasedClient::dispatch(sub_id_t sub_id, std::function<void()> callback) {
+    if (!m_dispatcher) {
+        callback();
+        return;
+    }
+    auto it = m_sub_mailboxes.find(sub_id);
+    if (it == m_sub_mailboxes.end()) {
+        MailboxOptions opts = m_mailbox_options;
+        if (m_sub_mailbox_options.find(sub_id) != m_sub_mailbox_options.end()) {
+            opts = m_sub_mailbox_options.at(sub_id);
+        }
+        if (m_patch_callbacks.find(sub_id) != m_patch_callbacks.end()) {
+            // Every patch applies to the one before it, none can be dropped.
+            opts.capacity = 0;
         }
-        m_channel_unsub_queue.clear();
+        it = m_sub_mailboxes.emplace(sub_id, m_dispatcher->make_mailbox(opts)).first;
+    }
+    it->second->post(std::move(callback));
+}
+
+void BasedClient::dispatch(std::function<void()> callback) {
+    if (!m_dispatcher) {
+        callback();
+        return;
+    }
+    if (!m_oneshot_mailbox) {
+        // Replies to calls, gets and auth are never dropped.
+        MailboxOptions opts;
+        opts.capacity = 0;
+        m_oneshot_mailbox = m_dispatcher->make_mailbox(opts);
     }
+    m_oneshot_mailbox->post(std::move(callback));
+}
+
+void BasedClient::close_mailbox(sub_id_t sub_id) {
+    m_sub_mailbox_options.erase(sub_id);
+    if (m_sub_mailboxes.find(sub_id) == m_sub_mailboxes.end()) return;
+    m_sub_mailboxes.at(sub_id)->close();
+    m_sub_mailboxes.erase(sub_id);
+}
 
-    if (!m_channel_publish_queue.empty()) {
-        for (auto msg : m_channel_publish_queue) {
-            buff.insert(buff.end(), msg.begin(), msg.end());
+void BasedClient::notify_subscribers(obs_id_t obs_id,
+                                     ObservableCache::Entry& entry,
+                                     bool changed) {
+    // The payload is shared by all the callbacks instead of copied for each of them, and only
+    // serialized if there is one to fire.
+    std::shared_ptr<const std::string> data;
+    checksum_t checksum = entry.checksum;
+
+    auto subs = m_obs_to_subs.find(obs_id);
+    if (changed && subs != m_obs_to_subs.end()) {
+        for (auto sub_id : subs->second) {
+            auto cb = m_sub_callback.find(sub_id);
+            // a patch observer
+            if (cb == m_sub_callback.end()) continue;
+            if (!data) data = entry.value();
+            auto fn = cb->second;
+            dispatch(sub_id, [fn, data, checksum, sub_id]() {
+                fn(data->c_str(), checksum, "", sub_id);
+            });
         }
-        m_channel_publish_queue.clear();
     }
 
-    if (!m_observe_queue.empty()) {
-        for (auto msg : m_observe_queue) {
-            buff.insert(buff.end(), msg.begin(), msg.end());
+    if (m_obs_to_gets.find(obs_id) != m_obs_to_gets.end()) {
+        for (auto sub_id : m_obs_to_gets.at(obs_id)) {
+            if (!data) data = entry.value();
+            auto fn = m_get_sub_callbacks.at(sub_id);
+            dispatch([fn, data, sub_id]() { fn(data->c_str(), "", sub_id); });
+            m_get_sub_callbacks.erase(sub_id);
         }
-        m_observe_queue.clear();
+        release_gets(obs_id);
+    }
+}
+
+void BasedClient::notify_patch_observers(obs_id_t obs_id,
+                                         std::shared_ptr<const std::string> data,
+                                         bool is_patch,
+                                         checksum_t checksum,
+                                         checksum_t prev_checksum) {
+    if (m_obs_to_subs.find(obs_id) == m_obs_to_subs.end()) return;
+
+    for (auto sub_id : m_obs_to_subs.at(obs_id)) {
+        auto patch_observer = m_patch_callbacks.find(sub_id);
+        if (patch_observer == m_patch_callbacks.end()) continue;
+        auto fn = patch_observer->second.cb;
+        dispatch(sub_id, [fn, data, is_patch, checksum, prev_checksum, sub_id]() {
+            fn(data->c_str(), is_patch, checksum, prev_checksum, "", sub_id);
+        });
     }
+}
+
+void BasedClient::set_flush_options(uint32_t window_us, size_t max_bytes) {
+    post([this, window_us, max_bytes]() {
+        m_flush_window_us = window_us;
+        m_flush_max_bytes = max_bytes;
+    });
+}
+
+void BasedClient::set_compression_options(size_t threshold, int level, double min_ratio) {
+    m_compression.set_options(threshold, level, min_ratio);
+}
+
+std::string BasedClient::get_compression_stats() {
+    return m_compression.stats();
+}
+
+void BasedClient::set_queue_limits(OutgoingType type,
+                                   size_t max_messages,
+                                   size_t max_bytes,
+                                   OverflowPolicy policy) {
+    post([this, type, max_messages, max_bytes, policy]() {
+        {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+            RequestQueue& queue = queue_for(type);
+            queue.max_messages = max_messages;
+            queue.max_bytes = max_bytes;
+            queue.policy = policy;
+        }
+        // the callers blocked on the old limits check them again
+        m_queue_drained.notify_all();
+    });
+}
 
-    if (!m_unobserve_queue.empty()) {
-        for (auto msg : m_unobserve_queue) {
-            buff.insert(buff.end(), msg.begin(), msg.end());
+void BasedClient::set_max_buffered_amount(size_t max_bytes) {
+    m_max_buffered_amount = max_bytes;
+}
+
+std::string BasedClient::get_queue_stats() {
+    static const std::pair<OutgoingType, const char*> types[] = {
+        {OutgoingType::FUNCTION, "function"},
+        {OutgoingType::SUBSCRIBE, "subscribe"},
+        {OutgoingType::UNSUBSCRIBE, "unsubscribe"},
+        {OutgoingType::GET, "get"},
+        {OutgoingType::AUTH, "auth"},
+        {OutgoingType::CHANNEL_SUBSCRIBE, "channelSubscribe"},
+        {OutgoingType::CHANNEL_PUBLISH, "channelPublish"},
+        {OutgoingType::CHANNEL_UNSUBSCRIBE, "channelUnsubscribe"},
+    };
+
+    json res = json::object();
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        for (auto& type : types) {
+            const RequestQueue& queue = queue_for(type.first);
+            res[type.second] = {
+                {"messages", queue.requests.size()}, {"bytes", queue.bytes},
+                {"dropped", queue.dropped},          {"blocked", queue.blocked},
+                {"maxMessages", queue.max_messages}, {"maxBytes", queue.max_bytes},
+            };
         }
-        m_unobserve_queue.clear();
     }
+    res["bufferedAmount"] = m_con.buffered_amount_snapshot();
+    return res.dump();
+}
+
+RequestQueue& BasedClient::queue_for(OutgoingType type) {
+    switch (type) {
+        case OutgoingType::FUNCTION:
+            return m_function_queue;
+        case OutgoingType::SUBSCRIBE:
+            return m_observe_queue;
+        case OutgoingType::UNSUBSCRIBE:
+            return m_unobserve_queue;
+        case OutgoingType::GET:
+            return m_get_queue;
+        case OutgoingType::AUTH:
+            return m_auth_queue;
+        case OutgoingType::CHANNEL_SUBSCRIBE:
+            return m_channel_sub_queue;
+        case OutgoingType::CHANNEL_PUBLISH:
+            return m_channel_publish_queue;
+        case OutgoingType::CHANNEL_UNSUBSCRIBE:
+            return m_channel_unsub_queue;
+    }
+    throw std::invalid_argument("Unknown request type");
+}
 
-    if (!m_function_queue.empty()) {
-        for (auto msg : m_function_queue) {
-            buff.insert(buff.end(), msg.begin(), msg.end());
+void BasedClient::enqueue(OutgoingType type, QueuedRequest req) {
+    // Requests that didn't make it into the queue, handled after the lock is released since
+    // their callbacks may make new requests.
+    std::vector<QueuedRequest> discarded;
+    bool notify = false;
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+
+        // Subscribes and unsubscribes are drained from different queues, so their order is
+        // lost. A pending one is cancelled by the opposite request for the same id instead, the
+        // last one made is what the server gets.
+        switch (type) {
+            case OutgoingType::SUBSCRIBE:
+                m_queued_bytes -= m_unobserve_queue.remove(req.id);
+                break;
+            case OutgoingType::UNSUBSCRIBE:
+                m_queued_bytes -= m_observe_queue.remove(req.id);
+                break;
+            case OutgoingType::CHANNEL_SUBSCRIBE:
+                m_queued_bytes -= m_channel_unsub_queue.remove(req.id);
+                break;
+            case OutgoingType::CHANNEL_UNSUBSCRIBE:
+                m_queued_bytes -= m_channel_sub_queue.remove(req.id);
+                break;
+            default:
+                break;
         }
-        m_function_queue.clear();
+
+        RequestQueue& queue = queue_for(type);
+        if (!queue.fits(req)) {
+            switch (queue.policy) {
+                case OverflowPolicy::BLOCK:
+                    // The callers already waited in wait_for_room, this is the io thread which
+                    // is the one draining the queues, it can't wait for itself.
+                    break;
+                case OverflowPolicy::DROP_OLDEST:
+                    while (!queue.fits(req)) {
+                        m_queued_bytes -= queue.requests.front().size();
+                        discarded.push_back(queue.pop_front());
+                        queue.dropped++;
+                    }
+                    break;
+                case OverflowPolicy::DROP_NEWEST:
+                case OverflowPolicy::FAIL:
+                    notify = queue.policy == OverflowPolicy::FAIL;
+                    queue.dropped++;
+                    discarded.push_back(std::move(req));
+                    break;
+            }
+        }
+
+        if (discarded.empty() || queue.policy == OverflowPolicy::DROP_OLDEST) {
+            m_queued_bytes += req.size();
+            queue.push(std::move(req));
+        }
+    }
+
+    for (auto& dropped : discarded) {
+        discard_request(type, dropped, notify);
+    }
+}
+
+void BasedClient::fail_pending() {
+    json error = {{"message", "Client closed before the request was answered"}};
+
+    for (auto& el : m_call_callbacks) {
+        auto fn = el.second;
+        req_id_t id = el.first;
+        error["requestId"] = id;
+        std::string err = error.dump();
+        dispatch([fn, err, id]() { fn("", err.c_str(), id); });
+    }
+    m_call_callbacks.clear();
+    error.erase("requestId");
+
+    std::string err = error.dump();
+    for (auto& el : m_get_sub_callbacks) {
+        auto fn = el.second;
+        sub_id_t sub_id = el.first;
+        dispatch([fn, err, sub_id]() { fn("", err.c_str(), sub_id); });
     }
+    m_get_sub_callbacks.clear();
+
+    if (m_auth_callback) {
+        auto fn = m_auth_callback;
+        dispatch([fn, err]() { fn(err.c_str()); });
+        m_auth_callback = NULL;
+    }
+}
 
-    if (!m_get_queue.empty()) {
-        for (auto msg : m_get_queue) {
-            buff.insert(buff.end(), msg.begin(), msg.end());
+void BasedClient::discard_request(OutgoingType type, const QueuedRequest& req, bool notify) {
+    json error = {{"message", "Request dropped, the queue is full"}};
+
+    switch (type) {
+        case OutgoingType::FUNCTION: {
+            if (m_call_callbacks.find(req.id) == m_call_callbacks.end()) break;
+            auto fn = m_call_callbacks.at(req.id);
+            m_call_callbacks.erase(req.id);
+            if (notify) {
+                error["requestId"] = req.id;
+                std::string err = error.dump();
+                req_id_t id = req.id;
+                dispatch([fn, err, id]() { fn("", err.c_str(), id); });
+            }
+        } break;
+        case OutgoingType::GET: {
+            {
+                // another get for the same observable is still queued and will answer them all
+                std::lock_guard<std::mutex> lock(m_queue_mutex);
+                for (auto& queued : m_get_queue.requests) {
+                    if (queued.id == req.id) return;
+                }
+            }
+            if (m_obs_to_gets.find(req.id) == m_obs_to_gets.end()) break;
+            auto sub_ids = m_obs_to_gets.at(req.id);
+            release_gets(req.id);
+            error["observableId"] = req.id;
+            std::string err = error.dump();
+            for (auto sub_id : sub_ids) {
+                auto fn = m_get_sub_callbacks.at(sub_id);
+                m_get_sub_callbacks.erase(sub_id);
+                if (notify) dispatch([fn, err, sub_id]() { fn("", err.c_str(), sub_id); });
+            }
+        } break;
+        case OutgoingType::AUTH:
+            m_auth_in_progress = false;
+            if (notify && m_auth_callback) {
+                auto fn = m_auth_callback;
+                std::string err = error.dump();
+                dispatch([fn, err]() { fn(err.c_str()); });
+            }
+            m_auth_callback = NULL;
+            break;
+        default:
+            // Observables and channels stay active and are sent again on reconnection,
+            // publishes and unsubscribes have no callback.
+            BASED_LOG("Dropped request of type %d for id %u, the queue is full", type, req.id);
+            break;
+    }
+}
+
+void BasedClient::schedule_flush() {
+    if (m_con.status() != ConnectionStatus::OPEN) {
+        // everything is drained when the connection opens
+        return;
+    }
+
+    if (m_queued_bytes >= m_flush_max_bytes) {
+        drain_queues();
+        return;
+    }
+
+    if (m_flush_scheduled.exchange(true)) {
+        // there is already a flush coming, the new requests will be sent with it
+        return;
+    }
+
+    // Even with a window of 0 the drain is deferred to the io thread, so all the requests made
+    // in a burst before it gets there end up in the same write.
+    m_flush_timer.expires_after(std::chrono::microseconds(m_flush_window_us));
+    m_flush_timer.async_wait([this](const asio::error_code& ec) {
+        if (ec == asio::error::operation_aborted) return;
+        m_flush_scheduled = false;
+        drain_queues();
+    });
+}
+
+void BasedClient::drain_queues() {
+    if (m_con.status() != ConnectionStatus::OPEN) {
+        // std::cerr << "Connection is unavailable, status = " << m_con.status() << std::endl;
+        return;
+    }
+
+    size_t max_buffered = m_max_buffered_amount;
+    if (max_buffered && m_con.buffered_amount() > max_buffered) {
+        // websocketpp is still busy with the previous writes, the requests are safer in the
+        // (bounded) queues than in its buffer. Try again in a bit.
+        if (!m_flush_scheduled.exchange(true)) {
+            m_flush_timer.expires_after(std::chrono::milliseconds(1));
+            m_flush_timer.async_wait([this](const asio::error_code& ec) {
+                if (ec == asio::error::operation_aborted) return;
+                m_flush_scheduled = false;
+                drain_queues();
+            });
         }
-        m_get_queue.clear();
+        return;
     }
 
-    if (!buff.empty()) {
-        if (m_con.status() == ConnectionStatus::OPEN) {
-            m_con.send(buff);
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+
+        m_send_buffer.clear();
+        m_queued_bytes = 0;
+
+        // The order matters: auth must always go first, so the server evaluates the rest of
+        // the requests with the right auth state.
+        std::pair<OutgoingType, RequestQueue*> queues[] = {
+            {OutgoingType::AUTH, &m_auth_queue},
+            {OutgoingType::CHANNEL_SUBSCRIBE, &m_channel_sub_queue},
+            {OutgoingType::CHANNEL_UNSUBSCRIBE, &m_channel_unsub_queue},
+            {OutgoingType::CHANNEL_PUBLISH, &m_channel_publish_queue},
+            {OutgoingType::SUBSCRIBE, &m_observe_queue},
+            {OutgoingType::UNSUBSCRIBE, &m_unobserve_queue},
+            {OutgoingType::FUNCTION, &m_function_queue},
+            {OutgoingType::GET, &m_get_queue},
+        };
+
+        for (auto& queue : queues) {
+            for (auto& req : queue.second->requests) {
+                encode_request(queue.first, req);
+            }
+            queue.second->clear();
+        }
+
+        if (!m_send_buffer.empty()) {
+            m_con.send(m_send_buffer);
         }
     }
+    m_queue_drained.notify_all();
+}
+
+void BasedClient::encode_request(OutgoingType type, const QueuedRequest& req) {
+    if (req.raw) {
+        Utility::append_string(m_send_buffer, req.payload);
+        return;
+    }
+
+    switch (type) {
+        case OutgoingType::FUNCTION:
+            Utility::encode_function_message(m_send_buffer, m_compression, req.id, req.name,
+                                             req.payload);
+            break;
+        case OutgoingType::SUBSCRIBE: {
+            if (m_active_observables.find(req.id) == m_active_observables.end()) {
+                // it was unobserved before the request could be sent
+                break;
+            }
+            auto obs = m_active_observables.at(req.id);
+            Utility::encode_observe_message(m_send_buffer, m_compression, req.id, obs->name,
+                                            obs->payload, cached_checksum(req.id));
+        } break;
+        case OutgoingType::UNSUBSCRIBE:
+            Utility::encode_unobserve_message(m_send_buffer, req.id);
+            break;
+        case OutgoingType::GET:
+            Utility::encode_get_message(m_send_buffer, m_compression, req.id, req.name,
+                                        req.payload, cached_checksum(req.id));
+            break;
+        case OutgoingType::AUTH:
+            Utility::encode_auth_message(m_send_buffer, m_compression, req.payload);
+            break;
+        case OutgoingType::CHANNEL_SUBSCRIBE:
+            Utility::encode_subscribe_channel_message(m_send_buffer, req.id, req.name, req.payload,
+                                                      req.is_request_subscriber);
+            break;
+        case OutgoingType::CHANNEL_PUBLISH:
+            Utility::encode_publish_channel_message(m_send_buffer, m_compression, req.id,
+                                                    req.payload);
+            break;
+        case OutgoingType::CHANNEL_UNSUBSCRIBE:
+            Utility::encode_unsubscribe_channel_message(m_send_buffer, req.id);
+            break;
+    }
+}
+
+checksum_t BasedClient::cached_checksum(obs_id_t obs_id) {
+    auto unpatched = m_unpatched.find(obs_id);
+    if (unpatched != m_unpatched.end()) return unpatched->second;
+    auto entry = m_cache.find(obs_id);
+    return entry ? entry->checksum : 0;
 }
 
 void BasedClient::request_full_data(obs_id_t obs_id) {
     if (m_active_observables.find(obs_id) == m_active_observables.end()) {
         return;
     }
-    auto obs = m_active_observables.at(obs_id);
-    auto msg = Utility::encode_observe_message(obs_id, obs->name, obs->payload, 0);
-    m_observe_queue.push_back(msg);
-    drain_queues();
+    // The cached value is out of sync, so it can't be used as the base for diffs anymore.
+    // Resetting the checksum makes the server send the full value.
+    if (auto entry = m_cache.find(obs_id)) {
+        entry->checksum = 0;
+    }
+    m_unpatched.erase(obs_id);
+    enqueue(OutgoingType::SUBSCRIBE, {obs_id});
+    schedule_flush();
 }
 
-void BasedClient::on_open() {
-    // TODO: must reencode the obs request with the latest checksum.
-    //       either change the checksum in the encoded request (harder probs) or
-    //       just encode it on drain queue rather than on .observe,
-    //       changing the data structure a bit
+void BasedClient::release_gets(obs_id_t obs_id) {
+    auto it = m_obs_to_gets.find(obs_id);
+    if (it == m_obs_to_gets.end()) return;
+    if (!it->second.empty()) m_cache.unpin(obs_id);
+    m_obs_to_gets.erase(it);
+}
+
+void BasedClient::mark_persist(obs_id_t obs_id) {
+    if (m_env_key.empty() || !PersistentCache::get().enabled()) return;
+    if (m_active_observables.find(obs_id) == m_active_observables.end()) return;
 
-    if (m_auth_state.size() > 0) {
-        set_auth_state(m_auth_state, NULL);
+    m_persist_dirty.insert(obs_id);
+    if (m_persist_scheduled) return;
+    m_persist_scheduled = true;
+
+    std::weak_ptr<bool> alive = m_alive;
+    m_persist_timer.expires_after(std::chrono::milliseconds(BASED_PERSIST_INTERVAL_MS));
+    m_persist_timer.async_wait([this, alive](const asio::error_code& ec) {
+        if (ec || alive.expired()) return;
+        persist();
+    });
+}
+
+void BasedClient::persist() {
+    m_persist_scheduled = false;
+    for (auto obs_id : m_persist_dirty) {
+        auto entry = m_cache.find(obs_id);
+        // 0 means the value is out of sync with the server
+        if (!entry || entry->checksum == 0) continue;
+        PersistentCache::get().store(m_env_key, obs_id, *entry->value(), entry->checksum);
     }
+    m_persist_dirty.clear();
+}
 
-    for (auto el : m_active_observables) {
-        Observable* obs = el.second;
-        auto msg = Utility::encode_observe_message(el.first, obs->name, obs->payload, 0);
-        m_observe_queue.push_back(msg);
+void BasedClient::on_open() {
+    // A standby that took over is already authenticated, unless the state changed since
+    bool authenticated = m_con.promoted_standby() && m_standby_auth_state == m_auth_state;
+    if (m_auth_state.size() > 0 && !authenticated) {
+        queue_auth(m_auth_state, NULL);
+    }
+
+    {
+        // Every active observable is resent anyway, so the ones queued while the connection was
+        // down would only be duplicates.
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_queued_bytes -= m_observe_queue.bytes;
+        m_observe_queue.clear();
+        for (auto& el : m_active_observables) {
+            // an unobserve queued before it was observed again would cancel it on the server
+            m_queued_bytes -= m_unobserve_queue.remove(el.first);
+            m_observe_queue.push({el.first});
+            m_queued_bytes += m_observe_queue.requests.back().size();
+        }
     }
     drain_queues();
 }
 
-void BasedClient::on_message(std::string message) {
-    int32_t header = Utility::read_header(message);
+void BasedClient::on_standby_open() {
+    m_standby_auth_state = m_auth_state;
+    if (m_auth_state.empty()) return;
+
+    // Sent directly, the queues only feed the primary connection
+    std::vector<uint8_t> message;
+    Utility::encode_auth_message(message, m_compression, m_auth_state);
+    m_con.send_standby(message);
+}
+
+void BasedClient::on_message(const std::string& message) {
+    // A single message can contain many frames, for example when the server coalesces
+    // small updates.
+    FrameIterator frames{FrameView(message)};
+    FrameView frame;
+    try {
+        while (frames.next(frame)) {
+            try {
+                handle_frame(frame);
+            } catch (std::exception& e) {
+                // Bad json or compressed data only spoils this frame, the next one starts where
+                // its header says this one ends.
+                BASED_LOG("Dropped a frame that can't be handled: %s", e.what());
+            }
+        }
+    } catch (std::out_of_range& e) {
+        // There is no way to find where the next frame starts, so the rest is dropped.
+        BASED_LOG("Malformed message received: %s", e.what());
+    }
+}
+
+void BasedClient::handle_frame(const FrameView& frame) {
+    int32_t header = frame.header();
     int32_t type = Utility::get_payload_type(header);
     int32_t len = Utility::get_payload_len(header);
     int32_t is_deflate = Utility::get_payload_is_deflate(header);
 
     switch (type) {
         case IncomingType::FUNCTION_DATA: {
-            req_id_t id = (req_id_t)Utility::read_bytes_from_string(message, 4, 3);
+            req_id_t id = (req_id_t)frame.read_uint(4, 3);
 
             if (m_call_callbacks.find(id) != m_call_callbacks.end()) {
                 auto fn = m_call_callbacks.at(id);
+                std::string payload = "";
                 if (len != 3) {
-                    int start = 7;
-                    int end = len + 4;
-                    std::string payload = is_deflate
-                                              ? Utility::inflate_string(message.substr(start, end))
-                                              : message.substr(start, end);
-                    fn(payload.c_str(), "", id);
-                } else {
-                    fn("", "", id);
+                    // | 4 header | 3 id | * payload |
+                    payload = read_payload(frame.sub(7, len - 3), is_deflate);
                 }
+                dispatch([fn, payload, id]() { fn(payload.c_str(), "", id); });
                 // Listener has fired, remove it from the map.
                 m_call_callbacks.erase(id);
             }
         }
             return;
         case IncomingType::SUBSCRIPTION_DATA: {
-            obs_id_t obs_id = (obs_id_t)Utility::read_bytes_from_string(message, 4, 8);
-            uint64_t checksum = Utility::read_bytes_from_string(message, 12, 8);
+            // | 4 header | 8 id | 8 checksum | * payload |
+            obs_id_t obs_id = (obs_id_t)frame.read_u64(4);
+            uint64_t checksum = frame.read_u64(12);
 
-            int start = 20;  // size of header
-            int end = len + 4;
             std::string payload = "";
             if (len != 16) {
-                payload = is_deflate ? Utility::inflate_string(message.substr(start, end))
-                                     : message.substr(start, end);
+                payload = read_payload(frame.sub(20, len - 16), is_deflate);
             }
 
-            m_cache[obs_id].first = payload;
-            m_cache[obs_id].second = checksum;
-
-            if (m_obs_to_subs.find(obs_id) != m_obs_to_subs.end()) {
-                for (auto sub_id : m_obs_to_subs.at(obs_id)) {
-                    auto fn = m_sub_callback.at(sub_id);
-                    fn(payload.c_str(), checksum, "", sub_id);
-                }
+            // Nothing changed, e.g. the answer to a subscribe made with the cached checksum
+            auto entry = m_cache.find(obs_id);
+            if (entry && entry->checksum == checksum) {
+                notify_subscribers(obs_id, *entry, false);
+                return;
             }
-
-            if (m_obs_to_gets.find(obs_id) != m_obs_to_gets.end()) {
-                for (auto sub_id : m_obs_to_gets.at(obs_id)) {
-                    auto fn = m_get_sub_callbacks.at(sub_id);
-                    fn(payload.c_str(), "", sub_id);
-                    m_get_sub_callbacks.erase(sub_id);
-                }
-                m_obs_to_gets.at(obs_id).clear();
+            auto unpatched = m_unpatched.find(obs_id);
+            if (unpatched != m_unpatched.end()) {
+                if (unpatched->second == checksum) return;
+                // the full value catches the cache up
+                m_unpatched.erase(unpatched);
             }
+
+            auto data = std::make_shared<const std::string>(std::move(payload));
+            auto& updated = m_cache.put(obs_id, data, checksum);
+            mark_persist(obs_id);
+
+            notify_subscribers(obs_id, updated, true);
+            notify_patch_observers(obs_id, data, false, checksum, 0);
         }
             return;
         case IncomingType::SUBSCRIPTION_DIFF_DATA: {
-            obs_id_t obs_id = (obs_id_t)Utility::read_bytes_from_string(message, 4, 8);
-            uint64_t checksum = Utility::read_bytes_from_string(message, 12, 8);
-            uint64_t prev_checksum = Utility::read_bytes_from_string(message, 20, 8);
+            // | 4 header | 8 id | 8 checksum | 8 prev checksum | * patch |
+            obs_id_t obs_id = (obs_id_t)frame.read_u64(4);
+            uint64_t checksum = frame.read_u64(12);
+            uint64_t prev_checksum = frame.read_u64(20);
 
-            uint64_t cached_checksum = 0;
-
-            if (m_cache.find(obs_id) != m_cache.end()) {
-                cached_checksum = m_cache.at(obs_id).second;
-            }
+            uint64_t cached_checksum = this->cached_checksum(obs_id);
 
             if (cached_checksum == 0 || (cached_checksum != prev_checksum)) {
                 request_full_data(obs_id);
                 return;
             }
 
-            int start = 28;  // size of header
-            int end = len + 4;
             std::string patch = "";
             if (len != 24) {
-                patch = is_deflate ? Utility::inflate_string(message.substr(start, end))
-                                   : message.substr(start, end);
+                patch = read_payload(frame.sub(28, len - 24), is_deflate);
             }
 
-            std::string patched_payload = "";
-
-            if (!patch.empty()) {
-                json value = json::parse(m_cache.at(obs_id).first);
-                json patch_json = json::parse(patch);
-                json res = Diff::apply_patch(value, patch_json);
-                patched_payload = res.dump();
-
-                m_cache[obs_id].first = patched_payload;
-                m_cache[obs_id].second = checksum;
+            auto entry = m_cache.find(obs_id);
+            if (checksum == prev_checksum) {
+                if (entry) notify_subscribers(obs_id, *entry, false);
+                return;
             }
 
-            if (m_obs_to_subs.find(obs_id) != m_obs_to_subs.end()) {
-                for (auto sub_id : m_obs_to_subs.at(obs_id)) {
-                    auto fn = m_sub_callback.at(sub_id);
-                    fn(patched_payload.c_str(), checksum, "", sub_id);
-                }
+            auto patch_data = std::make_shared<const std::string>(std::move(patch));
+            bool active = m_active_observables.find(obs_id) != m_active_observables.end();
+            if (active && !needs_value(obs_id)) {
+                // Only patch observers that keep their own copy are left, the value isn't
+                // patched anymore and the stale one is dropped.
+                if (entry) m_cache.erase(obs_id);
+                m_unpatched[obs_id] = checksum;
+                notify_patch_observers(obs_id, patch_data, true, checksum, prev_checksum);
+                return;
+            }
+            if (!entry) {
+                request_full_data(obs_id);
+                return;
             }
 
-            if (m_obs_to_gets.find(obs_id) != m_obs_to_gets.end()) {
-                for (auto sub_id : m_obs_to_gets.at(obs_id)) {
-                    auto fn = m_get_sub_callbacks.at(sub_id);
-                    fn(patched_payload.c_str(), "", sub_id);
-                    m_get_sub_callbacks.erase(sub_id);
+            if (!patch_data->empty()) {
+                // The document stays parsed while the observable is active, so it's patched in
+                // place and only serialized when a callback needs the string. A patch that fails
+                // halfway leaves it neither old nor new: it's dropped and fetched again in full.
+                try {
+                    json patch_json = json::parse(*patch_data);
+                    Diff::apply_patch_in_place(entry->doc(), patch_json);
+                } catch (std::exception& e) {
+                    BASED_LOG("Can't apply the patch, fetching the whole value: %s", e.what());
+                    m_cache.erase(obs_id);
+                    request_full_data(obs_id);
+                    return;
                 }
-                m_obs_to_gets.at(obs_id).clear();
+                entry->changed();
             }
+            entry->checksum = checksum;
+            m_cache.updated(obs_id);
+            mark_persist(obs_id);
+
+            notify_subscribers(obs_id, *entry, true);
+            notify_patch_observers(obs_id, patch_data, true, checksum, prev_checksum);
 
         } break;
         case IncomingType::GET_DATA: {
-            uint64_t obs_id = Utility::read_bytes_from_string(message, 4, 8);
-            if (m_obs_to_gets.find(obs_id) != m_obs_to_gets.end() &&
-                m_cache.find(obs_id) != m_cache.end()) {
+            // | 4 header | 8 id |
+            obs_id_t obs_id = (obs_id_t)frame.read_u64(4);
+            auto entry = m_cache.find(obs_id);
+            if (m_obs_to_gets.find(obs_id) != m_obs_to_gets.end() && entry) {
+                auto data = entry->value();
                 for (auto sub_id : m_obs_to_gets.at(obs_id)) {
                     auto fn = m_get_sub_callbacks.at(sub_id);
-                    fn(m_cache.at(obs_id).first.c_str(), "", sub_id);
+                    dispatch([fn, data, sub_id]() { fn(data->c_str(), "", sub_id); });
                     m_get_sub_callbacks.erase(sub_id);
                 }
-                m_obs_to_gets.at(obs_id).clear();
+                release_gets(obs_id);
             }
         } break;
         case IncomingType::AUTH_DATA: {
-            int32_t start = 4;
-            int32_t end = len + 4;
+            // | 4 header | * payload |
             std::string payload = "";
             if (len != 3) {
-                payload = is_deflate ? Utility::inflate_string(message.substr(start, end))
-                                     : message.substr(start, end);
+                payload = read_payload(frame.sub(4, len), is_deflate);
             }
 
             if (payload == "true") {
@@ -581,9 +1409,13 @@ void BasedClient::on_message(std::string message) {
             } else {
                 m_auth_state = payload;
             }
+            std::atomic_store(&m_auth_state_snapshot,
+                              std::make_shared<const std::string>(m_auth_state));
             m_auth_in_progress = false;
             if (m_auth_callback) {
-                m_auth_callback(m_auth_state.c_str());
+                auto fn = m_auth_callback;
+                std::string state = m_auth_state;
+                dispatch([fn, state]() { fn(state.c_str()); });
                 // we remove the callback because we don't want it to fire again if the server
                 // updates the client's auth state
                 m_auth_callback = NULL;
@@ -591,12 +1423,10 @@ void BasedClient::on_message(std::string message) {
         }
             return;
         case IncomingType::ERROR_DATA: {
-            int32_t start = 4;
-            int32_t end = len + 4;
+            // | 4 header | * payload |
             std::string payload = "{}";
             if (len != 3) {
-                payload = is_deflate ? Utility::inflate_string(message.substr(start, end))
-                                     : message.substr(start, end);
+                payload = read_payload(frame.sub(4, len), is_deflate);
             }
 
             json error = json::parse(payload);
@@ -607,16 +1437,22 @@ void BasedClient::on_message(std::string message) {
 
                 if (m_call_callbacks.find(id) != m_call_callbacks.end()) {
                     auto fn = m_call_callbacks.at(id);
-                    fn("", payload.c_str(), id);
+                    int request_id = id;
+                    dispatch([fn, payload, request_id]() {
+                        fn("", payload.c_str(), request_id);
+                    });
                     m_call_callbacks.erase(id);
                 }
                 if (m_obs_to_gets.find(id) != m_obs_to_gets.end()) {
                     for (auto get_id : m_obs_to_gets.at(id)) {
                         auto fn = m_get_sub_callbacks.at(get_id);
-                        fn("", payload.c_str(), id);
+                        int request_id = id;
+                        dispatch([fn, payload, request_id]() {
+                            fn("", payload.c_str(), request_id);
+                        });
                         m_get_sub_callbacks.erase(get_id);
                     }
-                    m_obs_to_gets.erase(id);
+                    release_gets(id);
                 }
             } else if (error.find("observableId") != error.end()) {
                 auto obs_id = error.at("observableId");
@@ -625,7 +1461,14 @@ void BasedClient::on_message(std::string message) {
                     for (auto sub_id : m_obs_to_subs.at(obs_id)) {
                         if (m_sub_callback.find(sub_id) != m_sub_callback.end()) {
                             auto fn = m_sub_callback.at(sub_id);
-                            fn("", 0, payload.c_str(), sub_id);
+                            dispatch(sub_id, [fn, payload, sub_id]() {
+                                fn("", 0, payload.c_str(), sub_id);
+                            });
+                        } else if (m_patch_callbacks.find(sub_id) != m_patch_callbacks.end()) {
+                            auto fn = m_patch_callbacks.at(sub_id).cb;
+                            dispatch(sub_id, [fn, payload, sub_id]() {
+                                fn("", false, 0, 0, payload.c_str(), sub_id);
+                            });
                         }
                     }
                 }
@@ -633,10 +1476,10 @@ void BasedClient::on_message(std::string message) {
                 if (m_obs_to_gets.find(obs_id) != m_obs_to_gets.end()) {
                     for (auto sub_id : m_obs_to_gets.at(obs_id)) {
                         auto fn = m_get_sub_callbacks.at(sub_id);
-                        fn("", payload.c_str(), sub_id);
+                        dispatch([fn, payload, sub_id]() { fn("", payload.c_str(), sub_id); });
                         m_get_sub_callbacks.erase(sub_id);
                     }
-                    m_obs_to_gets.at(obs_id).clear();
+                    release_gets(obs_id);
                 }
             } else if (error.find("channelId") != error.end()) {
                 auto channel_id = error.at("channelId");
@@ -647,7 +1490,9 @@ void BasedClient::on_message(std::string message) {
                     for (auto sub_id : m_channel_to_subs.at(channel_id)) {
                         if (m_channel_callback.find(sub_id) != m_channel_callback.end()) {
                             auto fn = m_channel_callback.at(sub_id);
-                            fn("", payload.c_str(), sub_id);
+                            dispatch(sub_id, [fn, payload, sub_id]() {
+                                fn("", payload.c_str(), sub_id);
+                            });
                         }
                         m_channel_to_subs.erase(sub_id);
                         m_sub_to_channel.erase(sub_id);
@@ -662,37 +1507,42 @@ void BasedClient::on_message(std::string message) {
             // This case happens when the server needs more info about the channel.
             // We send that info and then we send the data back again.
 
-            obs_id_t obs_id = Utility::read_bytes_from_string(message, 4, 8);
+            // | 4 header | 8 id | * payload |
+            obs_id_t obs_id = (obs_id_t)frame.read_u64(4);
+            if (m_active_publish_channels.find(obs_id) == m_active_publish_channels.end()) {
+                BASED_LOG("Republish requested for unknown channel %u", obs_id);
+                return;
+            }
             auto obs = m_active_publish_channels.at(obs_id);
 
-            std::vector<uint8_t> msg =
-                Utility::encode_subscribe_channel_message(obs_id, obs->name, obs->payload, true);
-
-            m_channel_sub_queue.push_back(msg);
-
-            std::vector<uint8_t> buff;
-            Utility::append_string(buff, message);
-
-            m_channel_sub_queue.push_back(buff);
-            drain_queues();
+            QueuedRequest sub_req = {obs_id, obs->name, obs->payload};
+            sub_req.is_request_subscriber = true;
+            enqueue(OutgoingType::CHANNEL_SUBSCRIBE, sub_req);
+
+            // The message is sent back as it is, it's a valid publish message.
+            QueuedRequest publish_req;
+            publish_req.id = obs_id;
+            publish_req.payload = frame.to_string();
+            publish_req.raw = true;
+            enqueue(OutgoingType::CHANNEL_PUBLISH, publish_req);
+            schedule_flush();
         }
             return;
         case IncomingType::CHANNEL_MESSAGE: {
-            auto sub_type = Utility::read_bytes_from_string(message, 4, 1);
+            // | 4 header | 1 sub type | 8 id | * payload |
+            auto sub_type = frame.read_u8(4);
             if (sub_type == 0) {
-                obs_id_t obs_id = Utility::read_bytes_from_string(message, 5, 8);
-                int start = 13;
-                int end = len + 5;
+                obs_id_t obs_id = (obs_id_t)frame.read_u64(5);
 
                 std::string payload = "";
                 if (len != 9) {
-                    payload = is_deflate ? Utility::inflate_string(message.substr(start, end))
-                                         : message.substr(start, end);
+                    payload = read_payload(frame.sub(13, len - 9), is_deflate);
                 }
                 if (m_channel_to_subs.find(obs_id) != m_channel_to_subs.end()) {
+                    auto data = std::make_shared<const std::string>(std::move(payload));
                     for (auto sub_id : m_channel_to_subs.at(obs_id)) {
                         auto fn = m_channel_callback.at(sub_id);
-                        fn(payload.c_str(), "", sub_id);
+                        dispatch(sub_id, [fn, data, sub_id]() { fn(data->c_str(), "", sub_id); });
                     }
                 } else {
                     BASED_LOG("Channel message received, but no listeners with obs_id %d found",
@@ -700,7 +1550,7 @@ void BasedClient::on_message(std::string message) {
                 }
 
             } else {
-                BASED_LOG("Wrong subtype received... %lld", sub_type);
+                BASED_LOG("Wrong subtype received... %d", sub_type);
             }
         }
             return;
@@ -3,12 +3,23 @@
 
 #define BASED_EXPORT __attribute__((__visibility__("default")))
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
 
+#include "compression.hpp"
 #include "connection.hpp"
+#include "dispatcher.hpp"
+#include "frameview.hpp"
+#include "mpscqueue.hpp"
+#include "observablecache.hpp"
 #include "utility.hpp"
 
 struct Observable {
@@ -18,16 +29,143 @@ struct Observable {
     std::string payload;
 };
 
+/**
+ * A request waiting in one of the queues of the client. Which fields are used depends on the
+ * queue it's in. Observe requests only carry the obs_id, name and payload are taken from the
+ * active observable when encoding.
+ */
+struct QueuedRequest {
+    /**
+     * obs_id for observables and channels, request id for functions.
+     */
+    uint32_t id = 0;
+    std::string name;
+    std::string payload;
+    bool is_request_subscriber = false;
+    /**
+     * The payload is an already encoded message, which must be sent as it is.
+     */
+    bool raw = false;
+
+    /**
+     * @brief Estimate of the encoded size, the biggest header is 21 bytes.
+     */
+    size_t size() const { return 21 + name.size() + payload.size(); }
+};
+
+/**
+ * What happens to a request that doesn't fit in its queue.
+ */
+enum OverflowPolicy {
+    /**
+     * The caller of call, get or channel_publish waits until the queue is drained. Requests made
+     * from the io thread (e.g. from a callback) can't wait for it and go over the limit instead.
+     */
+    BLOCK = 0,
+    /**
+     * The oldest requests in the queue are dropped to make room.
+     */
+    DROP_OLDEST,
+    /**
+     * The new request is dropped.
+     */
+    DROP_NEWEST,
+    /**
+     * The new request is dropped and its callback fires with an error.
+     */
+    FAIL,
+};
+
+/**
+ * One of the request queues of the client, optionally bounded. Limits of 0 mean unbounded.
+ */
+struct RequestQueue {
+    std::deque<QueuedRequest> requests;
+    size_t bytes = 0;
+
+    size_t max_messages = 0;
+    size_t max_bytes = 0;
+    OverflowPolicy policy = OverflowPolicy::DROP_OLDEST;
+
+    /**
+     * Requests dropped or failed because the queue was full.
+     */
+    uint64_t dropped = 0;
+    /**
+     * Times a caller had to wait for room in the queue.
+     */
+    uint64_t blocked = 0;
+
+    bool fits(const QueuedRequest& req) const {
+        if (requests.empty()) return true;
+        if (max_messages && requests.size() + 1 > max_messages) return false;
+        if (max_bytes && bytes + req.size() > max_bytes) return false;
+        return true;
+    }
+
+    void push(QueuedRequest req) {
+        bytes += req.size();
+        requests.push_back(std::move(req));
+    }
+
+    /**
+     * @brief Remove the requests for id, returns their size.
+     */
+    size_t remove(uint32_t id) {
+        size_t removed = 0;
+        for (auto it = requests.begin(); it != requests.end();) {
+            if (it->id == id) {
+                removed += it->size();
+                it = requests.erase(it);
+            } else {
+                it++;
+            }
+        }
+        bytes -= removed;
+        return removed;
+    }
+
+    QueuedRequest pop_front() {
+        QueuedRequest req = std::move(requests.front());
+        requests.pop_front();
+        bytes -= req.size();
+        return req;
+    }
+
+    void clear() {
+        requests.clear();
+        bytes = 0;
+    }
+};
+
+/**
+ * All the state of the client is owned by the io thread of its connection. The public methods
+ * can be called from any thread: they only post a command, through a lock-free queue, that the
+ * io thread runs in order. The io_service is run by that single thread, so it serializes the
+ * commands with the incoming messages and the timers without any lock.
+ *
+ * Callbacks fire on the io thread, or on the dispatcher threads when set_dispatcher_threads is
+ * used.
+ */
 class BasedClient {
    private:
     WsConnection m_con;
 
-    req_id_t m_request_id;
-    sub_id_t m_sub_id;
+    /**
+     * Handed out by the public methods on the caller's thread, so they're atomic. Sub ids are
+     * unique in the process, so a subscription can move to another client and keep its id.
+     */
+    std::atomic<req_id_t> m_request_id;
+    static std::atomic<sub_id_t> s_sub_id;
 
     bool m_auth_in_progress;
     std::string m_auth_state;
     std::string m_auth_request_state;
+    /**
+     * The auth state sent on the standby connection, it doesn't need to be sent again when the
+     * standby takes over.
+     */
+    std::string m_standby_auth_state;
 
     void (*m_auth_callback)(const char*);
     std::map<int, void (*)(const char*, const char*, int)> m_call_callbacks;
@@ -37,22 +175,145 @@ class BasedClient {
     /////////////////////
 
     /**
-     * map<obs_id, <value, checksum>>
+     * Last value and checksum of the observables, bounded by a byte budget. Active observables
+     * and the ones with gets in flight are pinned.
      */
-    std::map<obs_id_t, std::pair<std::string, checksum_t>> m_cache;
+    ObservableCache m_cache;
+
+    /**
+     * What the values of this client are stored under in the PersistentCache, the env it
+     * connects to. Empty until connected.
+     */
+    std::string m_env_key;
+    /**
+     * Observables updated since they were last written to the PersistentCache. They're written
+     * at most once per BASED_PERSIST_INTERVAL_MS, however often they change.
+     */
+    std::set<obs_id_t> m_persist_dirty;
+    bool m_persist_scheduled;
+    asio::steady_timer m_persist_timer;
 
     /////////////////////
     // queues
     /////////////////////
 
-    std::vector<std::vector<uint8_t>> m_observe_queue;
-    std::vector<std::vector<uint8_t>> m_function_queue;
-    std::vector<std::vector<uint8_t>> m_unobserve_queue;
-    std::vector<std::vector<uint8_t>> m_get_queue;
-    std::vector<std::vector<uint8_t>> m_channel_sub_queue;
-    std::vector<std::vector<uint8_t>> m_channel_unsub_queue;
-    std::vector<std::vector<uint8_t>> m_channel_publish_queue;
-    std::vector<uint8_t> m_auth_queue;
+    /**
+     * The queues hold descriptors of the pending requests, they are only encoded into
+     * m_send_buffer when drained. This way observables are always sent with the latest checksum
+     * in m_cache, even when they were queued before a reconnection.
+     */
+    RequestQueue m_observe_queue;
+    RequestQueue m_function_queue;
+    RequestQueue m_unobserve_queue;
+    RequestQueue m_get_queue;
+    RequestQueue m_channel_sub_queue;
+    RequestQueue m_channel_unsub_queue;
+    RequestQueue m_channel_publish_queue;
+    RequestQueue m_auth_queue;
+
+    /**
+     * Reusable buffer the queues are encoded into on drain, and that is handed
+     * to the connection as a single write.
+     */
+    std::vector<uint8_t> m_send_buffer;
+
+    /**
+     * The queues are filled and drained by the io thread, like the rest of the state. They still
+     * have a lock because of the BLOCK policy: wait_for_room runs on the caller's thread, before
+     * the request is posted, and has to see the queue empty out. get_queue_stats reads them
+     * under it too, instead of waiting for the io thread.
+     */
+    std::mutex m_queue_mutex;
+
+    /**
+     * Signaled when the queues are drained, for the callers blocked on a full queue.
+     */
+    std::condition_variable m_queue_drained;
+
+    /**
+     * Estimate of the size of everything in the queues.
+     */
+    std::atomic<size_t> m_queued_bytes;
+
+    /////////////////////
+    // flush scheduling
+    /////////////////////
+
+    /**
+     * Requests are not sent right away, they are held for this amount of time so that the ones
+     * that follow end up in the same write. Io thread only, like m_flush_max_bytes.
+     */
+    uint32_t m_flush_window_us;
+
+    /**
+     * The queues are drained immediately once they hold at least this many bytes.
+     */
+    size_t m_flush_max_bytes;
+
+    std::atomic<bool> m_flush_scheduled;
+    asio::steady_timer m_flush_timer;
+
+    /**
+     * Nothing new is handed to websocketpp while it holds more than this many unsent bytes, the
+     * requests wait in the queues instead, where they're bounded. 0 means no limit.
+     */
+    std::atomic<size_t> m_max_buffered_amount;
+
+    /////////////////////
+    // executor
+    /////////////////////
+
+    /**
+     * Commands posted by the public methods, run in order on the io thread.
+     */
+    MpscQueue<std::function<void()>> m_commands;
+
+    /**
+     * Whether a run of the commands is already posted to the io thread.
+     */
+    std::atomic<bool> m_commands_scheduled;
+
+    /**
+     * Copy of m_auth_state for get_auth_state, which can be called from any thread. Replaced
+     * as a whole with std::atomic_store when the auth state changes.
+     */
+    std::shared_ptr<const std::string> m_auth_state_snapshot;
+
+    /**
+     * Expires when the client is destroyed, for the handlers that are still posted to the io
+     * thread.
+     */
+    std::shared_ptr<bool> m_alive;
+
+    /////////////////////
+    // callback dispatch
+    /////////////////////
+
+    /**
+     * Runs the user callbacks when set, otherwise they run on the io thread.
+     */
+    std::unique_ptr<Dispatcher> m_dispatcher;
+
+    /**
+     * One mailbox per observe and channel subscription, created on their first message.
+     */
+    std::map<sub_id_t, std::shared_ptr<Mailbox>> m_sub_mailboxes;
+
+    /**
+     * Shared by the one shot callbacks: calls, gets and auth. Unbounded.
+     */
+    std::shared_ptr<Mailbox> m_oneshot_mailbox;
+
+    /**
+     * Options of the subscription mailboxes, unless overridden in m_sub_mailbox_options.
+     */
+    MailboxOptions m_mailbox_options;
+    std::map<sub_id_t, MailboxOptions> m_sub_mailbox_options;
+
+    /**
+     * Which outgoing payloads get deflated, and how well that works out.
+     */
+    Compression::Policy m_compression;
 
     /////////////////////
     // observables
@@ -84,6 +345,26 @@ class BasedClient {
      */
     std::map<sub_id_t, void (*)(const char*, checksum_t, const char*, int)> m_sub_callback;
 
+    struct PatchObserver {
+        void (*cb)(const char*, bool, checksum_t, checksum_t, const char*, int);
+        bool keep_value;
+    };
+
+    /**
+     * map<sub_id, patch observer>
+     * Subscribers made with observe_patches. They're in m_obs_to_subs like the others, but not
+     * in m_sub_callback.
+     */
+    std::map<sub_id_t, PatchObserver> m_patch_callbacks;
+
+    /**
+     * map<obs_hash, checksum>
+     * Observables whose patches aren't applied, because only patch observers that keep their own
+     * copy are left. The value is dropped from the cache and only the checksum of the last patch
+     * is tracked, the full value is requested again when something needs it.
+     */
+    std::map<obs_id_t, checksum_t> m_unpatched;
+
     ////////////////
     // channels
     ////////////////
@@ -141,6 +422,7 @@ class BasedClient {
 
    public:
     BasedClient(bool enable_tls);
+    ~BasedClient();
 
     /**
      * @brief Function to retrieve the url of a specific service.
@@ -153,7 +435,8 @@ class BasedClient {
      * @param key Optional string, for named hubs or other named service.
      * @param optional_key Boolean, set to true if it should fall back to the default service in
      * case the named one is not found
-     * @return std::string of the url
+     * @return std::string of the url, empty if it can't be found. Blocks until it's found,
+     * see discover_service_async.
      */
     std::string discover_service(std::string cluster,
                                  std::string org,
@@ -164,6 +447,24 @@ class BasedClient {
                                  bool optional_key,
                                  bool html);
 
+    /**
+     * @brief Same as discover_service, without blocking. Failed requests are retried on a timer,
+     * the callback gets an error if they keep failing.
+     *
+     * @return The id that will also be passed in the callback.
+     */
+    int discover_service_async(std::string cluster,
+                               std::string org,
+                               std::string project,
+                               std::string env,
+                               std::string name,
+                               std::string key,
+                               bool optional_key,
+                               bool html,
+                               void (*cb)(const char* /*url*/,
+                                          const char* /*error*/,
+                                          int /*request_id*/));
+
     /**
      * @brief Connect directly to a websocket url.
      */
@@ -207,6 +508,47 @@ class BasedClient {
          */
         void (*cb)(const char* /*data*/, checksum_t, const char* /*error*/, int /*sub_id*/));
 
+    /**
+     * @brief Observe with a sub_id handed out by another client, to move a subscription from one
+     * client to another without changing its id.
+     */
+    void add_observer(sub_id_t sub_id,
+                      std::string name,
+                      std::string payload,
+                      void (*cb)(const char*, checksum_t, const char*, int));
+
+    /**
+     * @brief Observe a function, receiving the patches sent by the server instead of the whole
+     * value on every change. The callback first gets the full value (is_patch false), then every
+     * patch with the checksum it leads to and the checksum it applies to. A full value can come
+     * again at any time, when the client went out of sync, and replaces the previous one.
+     * Its mailbox is always unbounded, whatever set_mailbox_options says, so no patch is dropped.
+     * Unobserve with .unobserve(id).
+     *
+     * @param keep_value Keep patching the cached value. If no subscriber needs it, only patch
+     * observers that don't keep it, patches are passed on without being applied, which costs
+     * O(patch) instead of O(document) per update.
+     */
+    int observe_patches(std::string name,
+                        std::string payload,
+                        bool keep_value,
+                        void (*cb)(const char* /*data or patch*/,
+                                   bool /*is_patch*/,
+                                   checksum_t /*checksum*/,
+                                   checksum_t /*prev_checksum*/,
+                                   const char* /*error*/,
+                                   int /*sub_id*/));
+
+    /**
+     * @brief observe_patches with a sub_id handed out by another client, see add_observer.
+     */
+    void add_patch_observer(
+        sub_id_t sub_id,
+        std::string name,
+        std::string payload,
+        bool keep_value,
+        void (*cb)(const char*, bool, checksum_t, checksum_t, const char*, int));
+
     /**
      * @brief Get the value of an observable only once. The callback will trigger when the function
      * fires a new update.
@@ -257,15 +599,247 @@ class BasedClient {
                           std::string payload,
                           void (*cb)(const char* /*data*/, const char* /*error*/, int /*sub_id*/));
 
+    /**
+     * @brief Subscribe to a channel with a sub_id handed out by another client, see add_observer.
+     */
+    void add_channel_subscriber(sub_id_t sub_id,
+                                std::string name,
+                                std::string payload,
+                                void (*cb)(const char*, const char*, int));
+
     void channel_unsubscribe(int sub_id);
 
     void channel_publish(std::string name, std::string payload, std::string message);
 
+    /**
+     * @brief Send everything that is queued right away, without waiting for the flush window.
+     */
+    void flush();
+
+    /**
+     * @brief Configure how outgoing requests are batched.
+     *
+     * @param window_us How long requests are held, in microseconds, before being sent together.
+     * With 0 they're sent as soon as the io thread gets to them.
+     * @param max_bytes The requests are sent right away once the queues hold this many bytes.
+     */
+    void set_flush_options(uint32_t window_us, size_t max_bytes);
+
+    /**
+     * @brief Configure when outgoing payloads are deflated, see Compression::Policy.
+     *
+     * @param threshold Only payloads longer than this many bytes are deflated.
+     * @param level 1 (fastest) to 9 (smallest), -1 for the zlib default, 0 disables compression.
+     * @param min_ratio Payloads are sent uncompressed when deflate doesn't shrink them by at
+     * least this ratio (original size / deflated size).
+     */
+    void set_compression_options(size_t threshold, int level, double min_ratio);
+
+    /**
+     * @brief Compression stats per message type, as json.
+     */
+    std::string get_compression_stats();
+
+    /**
+     * @brief Bound the queue of one type of request.
+     *
+     * @param max_messages Maximum number of requests in the queue, 0 for no limit.
+     * @param max_bytes Maximum size of the queued requests, 0 for no limit.
+     * @param policy What to do with a request that doesn't fit.
+     */
+    void set_queue_limits(OutgoingType type,
+                          size_t max_messages,
+                          size_t max_bytes,
+                          OverflowPolicy policy);
+
+    /**
+     * @brief Stop writing to the connection while it has more than max_bytes unsent, 0 for no
+     * limit.
+     */
+    void set_max_buffered_amount(size_t max_bytes);
+
+    /**
+     * @brief Depth of every queue, how many requests they dropped, and the amount buffered in
+     * the connection, as json.
+     */
+    std::string get_queue_stats();
+
+    /**
+     * @brief Run the callbacks on a pool of threads instead of the io thread, so slow callbacks
+     * don't hold up the connection. 0 (the default) runs them on the io thread.
+     */
+    void set_dispatcher_threads(size_t threads);
+
+    /**
+     * @brief Configure the mailbox of a subscription, which holds its pending callbacks when
+     * they run on the dispatcher.
+     *
+     * @param sub_id An observe or channel subscription, or -1 for the default of the new ones.
+     * @param capacity Pending callbacks, 0 for no limit.
+     * @param policy What happens to a callback when the mailbox is full.
+     */
+    void set_mailbox_options(int sub_id, size_t capacity, MailboxPolicy policy);
+
+    /**
+     * @brief The default mailbox options, and the options and dropped callbacks of the
+     * subscription mailboxes, as json.
+     */
+    std::string get_mailbox_stats();
+
+    /**
+     * @brief Rank the hubs of the env again every interval_ms, 0 (the default) to stop. The
+     * connection doesn't move, a reconnect goes to the fastest hub of the last ranking.
+     */
+    void set_hub_reevaluation(uint32_t interval_ms);
+
+    /**
+     * @brief Backoff between reconnect attempts, see WsConnection::set_reconnect_options.
+     */
+    void set_reconnect_options(uint32_t base_ms, double multiplier, uint32_t max_ms);
+
+    /**
+     * @brief Reconnect attempts and delays, as json.
+     */
+    std::string get_reconnect_stats();
+
+    /**
+     * @brief Ping interval and missed pongs before reconnecting, see WsConnection::set_heartbeat.
+     */
+    void set_heartbeat(uint32_t interval_ms, uint32_t max_missed);
+
+    /**
+     * @brief Heartbeat counters and round trip times, as json.
+     */
+    std::string get_heartbeat_stats();
+
+    /**
+     * @brief Keep an authenticated standby connection to another hub, which takes over
+     * with a single resubscribe when the connection is lost.
+     */
+    void set_standby(bool enabled);
+
+    /**
+     * @brief Bytes the cached values of inactive observables can take, 0 for no limit.
+     */
+    void set_cache_budget(size_t bytes);
+
+    /**
+     * @brief Size of the observable cache and its evictions, as json.
+     */
+    std::string get_cache_stats();
+
    private:
     /**
-     * @brief Handle incoming messages.
+     * @brief Handle incoming messages, frame by frame.
+     */
+    void on_message(const std::string& message);
+
+    /**
+     * @brief Decode a single frame and fire the related callbacks.
+     */
+    void handle_frame(const FrameView& frame);
+
+    /**
+     * @brief Run command on the io thread, after the ones posted before it. Never blocks.
+     */
+    void post(std::function<void()> command);
+
+    /**
+     * @brief Run all the posted commands, on the io thread.
      */
-    void on_message(std::string message);
+    void run_commands();
+
+    /**
+     * @brief Run the callback of a subscription, through its mailbox if there's a dispatcher.
+     */
+    void dispatch(sub_id_t sub_id, std::function<void()> callback);
+
+    /**
+     * @brief Run a one shot callback, through the dispatcher if there's one.
+     */
+    void dispatch(std::function<void()> callback);
+
+    /**
+     * @brief Drop the mailbox of a subscription and its pending callbacks.
+     */
+    void close_mailbox(sub_id_t sub_id);
+
+    /**
+     * @brief Fire the callbacks of the subscribers and of the pending gets of an observable,
+     * except the patch observers. The value is only serialized if there is a callback to fire.
+     *
+     * @param changed False when the value has the checksum that was already cached, then only
+     * the gets are answered.
+     */
+    void notify_subscribers(obs_id_t obs_id, ObservableCache::Entry& entry, bool changed);
+
+    /**
+     * @brief Fire the callbacks of the patch observers of an observable.
+     *
+     * @param data A patch, or the full value when is_patch is false.
+     */
+    void notify_patch_observers(obs_id_t obs_id,
+                                std::shared_ptr<const std::string> data,
+                                bool is_patch,
+                                checksum_t checksum,
+                                checksum_t prev_checksum);
+
+    /**
+     * @brief Make obs_id active, if it isn't yet, and add sub_id to its subscribers. The
+     * callback of the subscriber is registered by the caller.
+     */
+    void add_subscriber(obs_id_t obs_id, sub_id_t sub_id, std::string name, std::string payload);
+
+    /**
+     * @brief The cached value of obs_id, to give to a new subscriber. nullptr if there is none,
+     * or if it wasn't patched, then the full value is requested again.
+     */
+    ObservableCache::Entry* current_value(obs_id_t obs_id);
+
+    /**
+     * @brief Whether a subscriber or a pending get needs the patches of obs_id to be applied to
+     * the cached value.
+     */
+    bool needs_value(obs_id_t obs_id);
+
+    /**
+     * @brief Queue the auth request, on the io thread.
+     */
+    void queue_auth(const std::string& state, void (*cb)(const char*));
+
+    /**
+     * @brief Wait until there's room in the queue for type, if its overflow policy is BLOCK.
+     * Only on the caller's thread, the io thread never waits.
+     */
+    void wait_for_room(OutgoingType type);
+
+    /**
+     * @brief Add a request to one of the queues, applying its overflow policy if it's full.
+     */
+    void enqueue(OutgoingType type, QueuedRequest req);
+
+    /**
+     * @brief The queue for a type of request.
+     */
+    RequestQueue& queue_for(OutgoingType type);
+
+    /**
+     * @brief Clean up after a request that was dropped from the queues, and fire its callback
+     * with an error if notify is set.
+     */
+    void discard_request(OutgoingType type, const QueuedRequest& req, bool notify);
+
+    /**
+     * @brief Fire the callbacks of the calls, gets and auth that are still waiting for an
+     * answer with an error, when the client goes away before it comes.
+     */
+    void fail_pending();
+
+    /**
+     * @brief Make sure the queues are drained when the flush window expires, or right away if
+     * they're over the size threshold.
+     */
+    void schedule_flush();
 
     /**
      * @brief Drain the request queues by sending the request message to the server
@@ -273,6 +847,16 @@ class BasedClient {
      */
     void drain_queues();
 
+    /**
+     * @brief Encode a queued request into m_send_buffer.
+     */
+    void encode_request(OutgoingType type, const QueuedRequest& req);
+
+    /**
+     * @brief Checksum of the cached value of an observable, 0 if there is none.
+     */
+    checksum_t cached_checksum(obs_id_t obs_id);
+
     /**
      * @brief When the client goes out of sync with the server, send request to get the full data
      * rather than the diffing patch.
@@ -281,10 +865,30 @@ class BasedClient {
      */
     void request_full_data(obs_id_t obs_id);
 
+    /**
+     * @brief Forget the gets waiting for obs_id, once they're answered, and unpin its value.
+     */
+    void release_gets(obs_id_t obs_id);
+
+    /**
+     * @brief Queue the cached value of an active observable for the PersistentCache.
+     */
+    void mark_persist(obs_id_t obs_id);
+
+    /**
+     * @brief Write the values queued by mark_persist.
+     */
+    void persist();
+
     /**
      * @brief (Re)send the list of active observables when the connection (re)opens
      */
     void on_open();
+
+    /**
+     * @brief Authenticate the standby connection, so it's ready to take over.
+     */
+    void on_standby_open();
 };
 
 #endif
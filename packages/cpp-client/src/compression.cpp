@@ -0,0 +1,295 @@
+#include "compression.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <json.hpp>
+#include <sstream>
+#include <stdexcept>
+
+#include "utility.hpp"
+
+using json = nlohmann::json;
+
+using namespace Compression;
+
+/**
+ * Size of the buffer zlib inflates into before the output is copied to the result.
+ */
+#define BASED_INFLATE_CHUNK 32768
+
+/**
+ * Payloads that inflate more than this (long runs of the same bytes) don't get reserved for, so a
+ * single one can't make every next payload reserve far more than it needs.
+ */
+#define BASED_INFLATE_MAX_RATIO 32
+
+/**
+ * Guess of the inflated size of a payload, the output is made that big up front and grows when
+ * it's not enough.
+ */
+static size_t initial_inflate_size(size_t len) {
+    return std::max<size_t>(len * 4, 1024);
+}
+
+/////////////////////////////////////////////////////////
+////////////////////// zlib /////////////////////////////
+/////////////////////////////////////////////////////////
+
+/**
+ * Setting up a z_stream is expensive, deflate alone allocates ~256KB of internal state, so both
+ * streams are kept alive and reset between messages.
+ */
+ZlibBackend::ZlibBackend()
+    : m_deflate_level(Z_DEFAULT_COMPRESSION),
+      m_inflate_chunk(BASED_INFLATE_CHUNK),
+      m_inflate_ratio(4) {
+    memset(&m_inflate_stream, 0, sizeof(m_inflate_stream));
+    memset(&m_deflate_stream, 0, sizeof(m_deflate_stream));
+
+    if (inflateInit2(&m_inflate_stream, -MAX_WBITS) != Z_OK)
+        throw(std::runtime_error("inflateInit failed while decompressing."));
+
+    // See https://www.zlib.net/manual.html#Advanced for details.
+    // The windowBits argument Must match inflate and the js client
+    if (deflateInit2(&m_deflate_stream, m_deflate_level, Z_DEFLATED, -MAX_WBITS, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+        inflateEnd(&m_inflate_stream);
+        throw(std::runtime_error("deflateInit failed while compressing."));
+    }
+}
+
+ZlibBackend::~ZlibBackend() {
+    inflateEnd(&m_inflate_stream);
+    deflateEnd(&m_deflate_stream);
+}
+
+std::string ZlibBackend::inflate(const char* data, size_t len) {
+    z_stream& zs = m_inflate_stream;
+    inflateReset(&zs);
+
+    zs.next_in = (Bytef*)data;
+    zs.avail_in = len;
+
+    std::string outstring;
+    // With some margin, the ratio changes a bit from one payload to the next
+    double ratio = std::min<double>(m_inflate_ratio, BASED_INFLATE_MAX_RATIO) * 1.125;
+    outstring.reserve(std::max<size_t>(len * ratio, 1024));
+
+    int ret;
+    do {
+        zs.next_out = reinterpret_cast<Bytef*>(m_inflate_chunk.data());
+        zs.avail_out = m_inflate_chunk.size();
+
+        ret = ::inflate(&zs, Z_NO_FLUSH);
+
+        outstring.append(m_inflate_chunk.data(), m_inflate_chunk.size() - zs.avail_out);
+    } while (ret == Z_OK);
+
+    if (ret != Z_STREAM_END) {  // an error occurred that was not EOF
+        std::ostringstream oss;
+        oss << "Exception during zlib decompression: (" << ret << ") "
+            << (zs.msg ? zs.msg : "");
+        throw(std::runtime_error(oss.str()));
+    }
+
+    if (len) m_inflate_ratio = (double)outstring.size() / len;
+    return outstring;
+}
+
+size_t ZlibBackend::deflate_append(std::vector<uint8_t>& buff,
+                                   const char* data,
+                                   size_t len,
+                                   int level) {
+    z_stream& zs = m_deflate_stream;
+    deflateReset(&zs);
+    if (level != m_deflate_level) {
+        // Nothing was fed to the stream since the reset, so this doesn't output anything.
+        if (deflateParams(&zs, level, Z_DEFAULT_STRATEGY) != Z_OK)
+            throw(std::runtime_error("deflateParams failed while compressing."));
+        m_deflate_level = level;
+    }
+
+    // deflateBound is an upper bound of the compressed size, so a single call to deflate
+    // is enough, writing directly at the end of buff.
+    size_t offset = buff.size();
+    buff.resize(offset + deflateBound(&zs, len));
+
+    zs.next_in = (Bytef*)data;
+    zs.avail_in = len;
+    zs.next_out = buff.data() + offset;
+    zs.avail_out = buff.size() - offset;
+
+    int ret = ::deflate(&zs, Z_FINISH);
+
+    if (ret != Z_STREAM_END) {
+        buff.resize(offset);
+        std::ostringstream oss;
+        oss << "Exception during zlib compression: (" << ret << ") " << (zs.msg ? zs.msg : "");
+        throw(std::runtime_error(oss.str()));
+    }
+
+    buff.resize(offset + zs.total_out);
+    return zs.total_out;
+}
+
+/////////////////////////////////////////////////////////
+/////////////////// libdeflate //////////////////////////
+/////////////////////////////////////////////////////////
+
+#ifdef BASED_LIBDEFLATE
+
+/**
+ * Same level zlib uses for Z_DEFAULT_COMPRESSION.
+ */
+#define BASED_LIBDEFLATE_DEFAULT_LEVEL 6
+
+LibdeflateBackend::LibdeflateBackend()
+    : m_decompressor(libdeflate_alloc_decompressor()), m_compressors() {
+    if (!m_decompressor) {
+        throw(std::runtime_error("libdeflate failed to allocate the decompressor."));
+    }
+}
+
+LibdeflateBackend::~LibdeflateBackend() {
+    libdeflate_free_decompressor(m_decompressor);
+    for (auto compressor : m_compressors) {
+        libdeflate_free_compressor(compressor);
+    }
+}
+
+std::string LibdeflateBackend::inflate(const char* data, size_t len) {
+    // libdeflate needs the whole output buffer up front, the inflated size is not in the
+    // protocol so it's retried with a bigger buffer until it fits.
+    std::string outstring;
+    outstring.resize(initial_inflate_size(len));
+
+    while (true) {
+        size_t written = 0;
+        libdeflate_result ret = libdeflate_deflate_decompress(
+            m_decompressor, data, len, &outstring[0], outstring.size(), &written);
+
+        if (ret == LIBDEFLATE_SUCCESS) {
+            outstring.resize(written);
+            return outstring;
+        }
+        if (ret != LIBDEFLATE_INSUFFICIENT_SPACE) {
+            std::ostringstream oss;
+            oss << "Exception during libdeflate decompression: (" << ret << ")";
+            throw(std::runtime_error(oss.str()));
+        }
+        outstring.resize(outstring.size() * 2);
+    }
+}
+
+size_t LibdeflateBackend::deflate_append(std::vector<uint8_t>& buff,
+                                         const char* data,
+                                         size_t len,
+                                         int level) {
+    // zlib levels map 1:1 to libdeflate ones, which go up to 12 but we don't expose those.
+    if (level == Z_DEFAULT_COMPRESSION) level = BASED_LIBDEFLATE_DEFAULT_LEVEL;
+    level = std::min(std::max(level, 0), 9);
+
+    libdeflate_compressor*& compressor = m_compressors[level];
+    if (!compressor) {
+        compressor = libdeflate_alloc_compressor(level);
+        if (!compressor) {
+            throw(std::runtime_error("libdeflate failed to allocate the compressor."));
+        }
+    }
+
+    size_t offset = buff.size();
+    buff.resize(offset + libdeflate_deflate_compress_bound(compressor, len));
+
+    size_t written = libdeflate_deflate_compress(compressor, data, len, buff.data() + offset,
+                                                 buff.size() - offset);
+
+    if (written == 0) {
+        buff.resize(offset);
+        throw(std::runtime_error("Exception during libdeflate compression."));
+    }
+
+    buff.resize(offset + written);
+    return written;
+}
+
+#endif
+
+Backend& Compression::backend() {
+#ifdef BASED_LIBDEFLATE
+    static thread_local LibdeflateBackend backend;
+#else
+    static thread_local ZlibBackend backend;
+#endif
+    return backend;
+}
+
+/////////////////////////////////////////////////////////
+///////////////////// Policy ////////////////////////////
+/////////////////////////////////////////////////////////
+
+Policy::Policy() : m_threshold(150), m_level(Z_DEFAULT_COMPRESSION), m_min_ratio(1.0) {}
+
+void Policy::set_options(size_t threshold, int level, double min_ratio) {
+    m_threshold = threshold;
+    // zlib fails on anything else, and a ratio below 1 means the same as 1: deflate is only kept
+    // when it's smaller. NaN ends up as 1 too.
+    m_level = std::min(std::max(level, Z_DEFAULT_COMPRESSION), Z_BEST_COMPRESSION);
+    m_min_ratio = min_ratio >= 1.0 ? min_ratio : 1.0;
+}
+
+int32_t Policy::append_payload(std::vector<uint8_t>& buff,
+                               const std::string& payload,
+                               int32_t type) {
+    TypeStats& stats = m_stats[type & 7];
+    stats.messages++;
+
+    int level = m_level;
+    if (level == 0 || payload.length() <= m_threshold) {
+        Utility::append_string(buff, payload);
+        return 0;
+    }
+
+    size_t offset = buff.size();
+    size_t deflated_len = backend().deflate_append(buff, payload.data(), payload.size(), level);
+
+    stats.bytes_in += payload.length();
+
+    // Not worth it, the server inflating it would only add to the latency
+    if (deflated_len >= payload.length() ||
+        (double)payload.length() / deflated_len < m_min_ratio) {
+        buff.resize(offset);
+        Utility::append_string(buff, payload);
+        stats.fallbacks++;
+        stats.bytes_out += payload.length();
+        return 0;
+    }
+
+    stats.deflated++;
+    stats.bytes_out += deflated_len;
+    return 1;
+}
+
+std::string Policy::stats() const {
+    static const char* type_names[8] = {
+        "function", "subscribe",        "unsubscribe",    "get",
+        "auth",     "channelSubscribe", "channelPublish", "channelUnsubscribe",
+    };
+
+    json res = json::object();
+    for (int i = 0; i < 8; i++) {
+        const TypeStats& stats = m_stats[i];
+        if (stats.messages == 0) continue;
+
+        uint64_t bytes_in = stats.bytes_in;
+        uint64_t bytes_out = stats.bytes_out;
+        res[type_names[i]] = {
+            {"messages", stats.messages.load()},
+            {"deflated", stats.deflated.load()},
+            {"fallbacks", stats.fallbacks.load()},
+            {"bytesIn", bytes_in},
+            {"bytesOut", bytes_out},
+            {"ratio", bytes_out ? (double)bytes_in / bytes_out : 1.0},
+        };
+    }
+    return res.dump();
+}
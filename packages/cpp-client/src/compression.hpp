@@ -0,0 +1,165 @@
+#ifndef BASED_COMPRESSION_H
+#define BASED_COMPRESSION_H
+
+#include <zlib.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef BASED_LIBDEFLATE
+#include <libdeflate.h>
+#endif
+
+/**
+ * The protocol only requires raw DEFLATE (no zlib or gzip wrapper), so any codec that can produce
+ * and read it can be plugged in here. Utility::inflate_string and Utility::deflate_string go
+ * through Compression::backend(), which is picked at build time:
+ *
+ * - zlib (default), streaming, always available.
+ * - libdeflate, when built with BASED_LIBDEFLATE. One-shot in-memory codec, usually 2-3x faster
+ *   than zlib on whole messages, which is always what we have.
+ *
+ * Backends keep their state between calls and are not thread safe, every thread gets its own.
+ */
+namespace Compression {
+
+class Backend {
+   public:
+    virtual ~Backend(){};
+
+    virtual const char* name() const = 0;
+
+    /**
+     * @brief Inflate raw DEFLATE data. Throws std::runtime_error if the data is invalid.
+     */
+    virtual std::string inflate(const char* data, size_t len) = 0;
+
+    /**
+     * @brief Deflate data to raw DEFLATE, directly at the end of buff.
+     *
+     * @param level zlib compression level, 1 to 9 or Z_DEFAULT_COMPRESSION.
+     * @return The size of the deflated data.
+     */
+    virtual size_t deflate_append(std::vector<uint8_t>& buff,
+                                  const char* data,
+                                  size_t len,
+                                  int level) = 0;
+};
+
+class ZlibBackend : public Backend {
+   public:
+    ZlibBackend();
+    ~ZlibBackend();
+
+    const char* name() const { return "zlib"; }
+    std::string inflate(const char* data, size_t len);
+    size_t deflate_append(std::vector<uint8_t>& buff, const char* data, size_t len, int level);
+
+   private:
+    z_stream m_inflate_stream;
+    z_stream m_deflate_stream;
+    int m_deflate_level;
+    /**
+     * Inflate writes here and the output is appended to the result from it, so the result never
+     * has to be zero-filled ahead of inflate, nor grown by more than what it gets.
+     */
+    std::vector<char> m_inflate_chunk;
+    /**
+     * Inflated to deflated size of the last payload, the next result is reserved with it so
+     * that it doesn't have to grow when the payloads are alike.
+     */
+    double m_inflate_ratio;
+};
+
+#ifdef BASED_LIBDEFLATE
+class LibdeflateBackend : public Backend {
+   public:
+    LibdeflateBackend();
+    ~LibdeflateBackend();
+
+    const char* name() const { return "libdeflate"; }
+    std::string inflate(const char* data, size_t len);
+    size_t deflate_append(std::vector<uint8_t>& buff, const char* data, size_t len, int level);
+
+   private:
+    libdeflate_decompressor* m_decompressor;
+    /**
+     * libdeflate compressors have a fixed level, they're created the first time a level is used.
+     */
+    libdeflate_compressor* m_compressors[10];
+};
+#endif
+
+/**
+ * @brief The backend selected at build time, one instance per thread.
+ */
+Backend& backend();
+
+/**
+ * Decides, per client, which outgoing payloads are deflated and how hard, and keeps track of how
+ * well it's going for every message type.
+ *
+ * Options can be changed from any thread, payloads are encoded by one thread at a time.
+ */
+class Policy {
+   public:
+    Policy();
+
+    /**
+     * @param threshold Only payloads longer than this many bytes are deflated.
+     * @param level zlib compression level, 1 (fastest) to 9 (smallest), Z_DEFAULT_COMPRESSION, or
+     * 0 to never compress. Clamped to that range.
+     * @param min_ratio The payload is sent uncompressed when original size / deflated size is
+     * below this, for instance 1.25 requires deflate to save at least 20%. At least 1.
+     */
+    void set_options(size_t threshold, int level, double min_ratio);
+
+    /**
+     * @brief Append payload to buff, deflated if the policy says so.
+     *
+     * @param type The OutgoingType of the message, for the stats.
+     * @return 1 if the payload was deflated, 0 otherwise.
+     */
+    int32_t append_payload(std::vector<uint8_t>& buff, const std::string& payload, int32_t type);
+
+    /**
+     * @brief The stats per message type, as a json object.
+     */
+    std::string stats() const;
+
+   private:
+    std::atomic<size_t> m_threshold;
+    std::atomic<int> m_level;
+    std::atomic<double> m_min_ratio;
+
+    struct TypeStats {
+        /**
+         * Payloads appended, deflated or not.
+         */
+        std::atomic<uint64_t> messages{0};
+        /**
+         * Payloads sent deflated.
+         */
+        std::atomic<uint64_t> deflated{0};
+        /**
+         * Payloads that were deflated but sent uncompressed, because of min_ratio.
+         */
+        std::atomic<uint64_t> fallbacks{0};
+        /**
+         * Size of the payloads deflate was tried on, before and after.
+         */
+        std::atomic<uint64_t> bytes_in{0};
+        std::atomic<uint64_t> bytes_out{0};
+    };
+
+    /**
+     * Indexed by OutgoingType.
+     */
+    TypeStats m_stats[8];
+};
+
+}  // namespace Compression
+
+#endif
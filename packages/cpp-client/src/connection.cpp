@@ -1,18 +1,62 @@
 #include "connection.hpp"
 #include <curl/curl.h>
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <ctime>
+#include <future>
 #include <iostream>
 #include <json.hpp>
+#include <random>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include "discoverycache.hpp"
+#include "hubprobe.hpp"
 #include "utility.hpp"
 
 #define DEFAULT_CLUSTER_NAME "production"
 
+/**
+ * Discovery attempts made while connecting to a cached hub, before giving up on the fallback.
+ */
+#define BASED_SPECULATIVE_DISCOVERY_ATTEMPTS 3
+
+/**
+ * How long the hubs from discovery are probed for, in ms. Hubs that haven't answered by then are
+ * only used once the others failed.
+ */
+#define BASED_HUB_PROBE_TIMEOUT_MS 2000
+
+/**
+ * Default reconnect backoff: the delay before attempt n is random between 0 and
+ * min(BASE * MULTIPLIER^(n-1), MAX) ms.
+ */
+#define BASED_BACKOFF_BASE_MS 100
+#define BASED_BACKOFF_MULTIPLIER 2.0
+#define BASED_BACKOFF_MAX_MS 5000
+
+/**
+ * Default heartbeat: a ping every interval, and the connection is dropped when that many pings in
+ * a row got no pong, which spots a dead link within about 10s.
+ */
+#define BASED_PING_INTERVAL_MS 5000
+#define BASED_MAX_MISSED_PONGS 2
+
+/**
+ * How long before a lost standby connection is opened again, in ms.
+ */
+#define BASED_STANDBY_RETRY_MS 5000
+
+/**
+ * Weight of the last rtt in the moving average.
+ */
+#define RTT_EWMA_ALPHA 0.2
+
+const double WsConnection::RTT_BUCKET_BOUNDS_MS[RTT_BUCKETS - 1] = {1,  2,   5,   10,  20,
+                                                                   50, 100, 200, 500, 1000};
+
 using namespace nlohmann::literals;
 using json = nlohmann::json;
 
@@ -52,9 +96,17 @@ size_t get_request_id_header(char* buffer, size_t size, size_t nitems, void* use
     return numbytes;
 }
 
+/**
+ * Seeded once per thread, reseeding with the time made clients started in the same second pick
+ * the same numbers.
+ */
+std::mt19937& random_engine() {
+    static thread_local std::mt19937 engine(std::random_device{}());
+    return engine;
+}
+
 int random_number() {
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
-    return static_cast<int>(std::floor(std::rand() / (RAND_MAX + 1.0) * 10000));
+    return std::uniform_int_distribution<int>(0, 9999)(random_engine());
 }
 
 std::string gen_cache(BasedConnectOpt opts) {
@@ -99,6 +151,17 @@ unsigned int getServicePort(const std::string& org,
     return port;
 }
 
+/**
+ * What the discovery cache is keyed by, everything that can change the hub.
+ */
+std::string cache_key(const BasedConnectOpt& opts, bool enable_tls) {
+    json key = {
+        enable_tls, opts.cluster, opts.org,          opts.project, opts.env,
+        opts.name,  opts.key,     opts.optional_key, opts.host,    opts.discovery_url,
+    };
+    return key.dump();
+}
+
 std::string gen_discovery_url(BasedConnectOpt opts) {
     if (opts.cluster == "local") {
         // If this were to connect to based-platform services,
@@ -120,84 +183,90 @@ std::string gen_discovery_url(BasedConnectOpt opts) {
     return url;
 }
 
-std::pair<std::string, std::string> WsConnection::make_request(std::string url,
-                                                               BasedConnectOpt opts) {
-    int timeout = m_reconnect_attempts > 15 ? 1500 : m_reconnect_attempts * 100;
-    if (m_reconnect_attempts > 0) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(timeout));
+void WsConnection::request_hubs(
+    std::string url,
+    BasedConnectOpt opts,
+    int max_attempts,
+    int attempt,
+    std::function<void(const std::vector<std::string>&, const std::string&)> cb,
+    uint64_t connect_attempt) {
+    std::string cache;
+    try {
+        cache = gen_cache(opts);
+    } catch (std::runtime_error& e) {
+        // Retrying won't help
+        cb({}, e.what());
+        return;
     }
-
-    CURL* curl;
-    struct curl_slist* list = NULL;
-    CURLcode res;
-    std::string request_id_header;
-    std::string buf;
-
-    curl = curl_easy_init();
-    if (!curl) {
-        throw std::runtime_error("curl object failed to initialize");
+    std::vector<std::string> headers = {"sequence-id: " + cache};
+    for (auto const& header : opts.headers) {
+        headers.push_back(header.first + ": " + header.second);
     }
 
-    // Set up curl
-    std::string sequence_id_header = "sequence-id: " + gen_cache(opts);
-    list = curl_slist_append(list, sequence_id_header.c_str());
-
-    if (opts.headers.size() > 0) {
-        for (auto const& header : opts.headers) {
-            std::string header_str = header.first + ": " + header.second;
-            list = curl_slist_append(list, header_str.c_str());
+    std::weak_ptr<bool> alive = m_alive;
+    auto on_response = [this, alive, url, opts, max_attempts, attempt, cb,
+                        connect_attempt](const AsyncHttp::Response& res) {
+        if (alive.expired()) return;
+
+        std::vector<std::pair<std::string, std::string>> pairs;
+        if (res.code == CURLE_OK && res.headers.find("x-request-id") != res.headers.end()) {
+            auto header_value = res.headers.at("x-request-id");
+            try {
+                if (header_value.size() < 6) throw std::runtime_error("header too short");
+                auto encode_chars = Utility::split_string(header_value.substr(0, 6), "");
+                auto encoded_value = header_value.substr(6);
+
+                std::string decoded_value = Utility::decode(encoded_value, encode_chars);
+
+                auto result = split_on_char(decoded_value, ',');
+                for (int i = 0; i < result.size() / 2; i++) {
+                    auto hub = result.at(i);
+                    auto key = Utility::encodeURIComponent(result.at(i + (result.size() / 2)));
+                    pairs.push_back((std::make_pair(hub, key)));
+                }
+            } catch (std::exception& e) {
+                BASED_LOG("Invalid discovery response: %s", e.what());
+                pairs.clear();
+            }
+        } else if (res.code != CURLE_OK) {
+            BASED_LOG("Discovery request failed: %s", curl_easy_strerror(res.code));
         }
-    }
-
-    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, list);
-
-    std::string connect_url = url + "/status/" + gen_cache(opts);
-    curl_easy_setopt(curl, CURLOPT_URL, connect_url.c_str());
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_function);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &buf);
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 5L);  // timeout in seconds
-    curl_easy_setopt(curl, CURLOPT_HEADER, 1L);
-    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, get_request_id_header);
-    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &request_id_header);
-
-    // TODO: fix it
-    // This is not good, but it's a pragmatic solution for now.
-    // No sensitive data is shared with this request, and the WebSocket connection will still be
-    // over TLS
-    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0);
 
-    res = curl_easy_perform(curl);
-
-    if (res != CURLE_OK) {
-        fprintf(stderr, "curl_easy_perform() failed: %s, trying again...\n",
-                curl_easy_strerror(res));
-        m_reconnect_attempts++;
-        return make_request(url, opts);
-    }
-    if (!(request_id_header.size() > 0)) {
-        m_reconnect_attempts++;
-        return make_request(url, opts);
-    }
-    m_reconnect_attempts = 0;
-
-    auto header_value = Utility::split_string(request_id_header, ": ")[1];
-    auto encode_chars = Utility::split_string(header_value.substr(0, 6), "");
-    auto encoded_value = header_value.substr(6);
-
-    std::string decoded_value = Utility::decode(encoded_value, encode_chars);
-
-    auto result = split_on_char(decoded_value, ',');
-    std::vector<std::pair<std::string, std::string>> pairs;
+        if (pairs.empty()) {
+            // A disconnect or another connect since, nobody waits for the hubs anymore
+            if (connect_attempt && connect_attempt != m_connect_attempt) return;
+            int failed = attempt + 1;
+            if (max_attempts && failed >= max_attempts) {
+                cb({}, "Service discovery failed after " + std::to_string(max_attempts) +
+                           " attempts");
+                return;
+            }
 
-    for (int i = 0; i < result.size() / 2; i++) {
-        auto hub = result.at(i);
-        auto key = Utility::encodeURIComponent(result.at(i + (result.size() / 2)));
-        pairs.push_back((std::make_pair(hub, key)));
-    }
+            // Retried on a timer, the io thread keeps running everything else meanwhile.
+            uint32_t timeout = backoff_delay(failed);
+            BASED_LOG("Discovery failed, trying again in %u ms...", timeout);
+            auto timer = std::make_shared<asio::steady_timer>(m_io.io);
+            timer->expires_after(std::chrono::milliseconds(timeout));
+            timer->async_wait([this, alive, timer, url, opts, max_attempts, failed, cb,
+                               connect_attempt](const asio::error_code& ec) {
+                if (ec || alive.expired()) return;
+                if (connect_attempt && connect_attempt != m_connect_attempt) return;
+                request_hubs(url, opts, max_attempts, failed, cb, connect_attempt);
+            });
+            return;
+        }
 
-    curl_easy_cleanup(curl);
+        // Shuffled so that hubs the probe can't tell apart still share the load
+        std::shuffle(pairs.begin(), pairs.end(), random_engine());
+        std::vector<std::string> hubs;
+        for (auto& pair : pairs) {
+            hubs.push_back(pair.first + "/" + pair.second);
+        }
+        cb(hubs, "");
+    };
 
-    return pairs.at(std::rand() % (pairs.size()));
+    std::string connect_url = url + "/status/" + cache;
+    m_http->get(connect_url, headers, 5, on_response);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -206,61 +275,162 @@ std::pair<std::string, std::string> WsConnection::make_request(std::string url,
 
 WsConnection::WsConnection(bool enable_tls)
     : m_status(ConnectionStatus::CLOSED),
+      m_buffered_snapshot(0),
+      m_io(IoPool::get().next()),
       m_on_open(NULL),
       m_on_message(NULL),
-      m_reconnect_attempts(0) {
+      m_reconnect_attempts(0),
+      m_connect_attempt(0),
+      m_http(new AsyncHttp(m_io.io)),
+      m_alive(std::make_shared<bool>(true)),
+      m_speculative(false),
+      m_discovery_pending(false),
+      m_hub_index(-1),
+      m_reevaluation_timer(new asio::steady_timer(m_io.io)),
+      m_reevaluation_ms(0),
+      m_reconnect_timer(new asio::steady_timer(m_io.io)),
+      m_backoff_base_ms(BASED_BACKOFF_BASE_MS),
+      m_backoff_multiplier(BASED_BACKOFF_MULTIPLIER),
+      m_backoff_max_ms(BASED_BACKOFF_MAX_MS),
+      m_opened(false),
+      m_stats_attempts(0),
+      m_stats_reconnects(0),
+      m_stats_consecutive(0),
+      m_stats_last_delay_ms(0),
+      m_heartbeat_timer(new asio::steady_timer(m_io.io)),
+      m_ping_interval_ms(BASED_PING_INTERVAL_MS),
+      m_max_missed_pongs(BASED_MAX_MISSED_PONGS),
+      m_ping_seq(0),
+      m_ping_outstanding(false),
+      m_missed_pongs(0),
+      m_rtt_ewma_ms(0),
+      m_rtt_last_ms(0),
+      m_rtt_histogram(),
+      m_pings_sent(0),
+      m_pongs(0),
+      m_missed_total(0),
+      m_dead_links(0),
+      m_standby_enabled(false),
+      m_standby_status(ConnectionStatus::CLOSED),
+      m_standby_timer(new asio::steady_timer(m_io.io)),
+      m_promoted(false),
+      m_stats_failovers(0) {
     m_enable_tls = enable_tls;
     BASED_LOG("ENABLE TLS = %d", m_enable_tls);
+    // Only the endpoint that is used is created, the other one would be an idle set of
+    // handlers and allocators for every client.
     if (m_enable_tls) {
-        m_wss_endpoint.clear_access_channels(websocketpp::log::alevel::all);
-        m_wss_endpoint.clear_error_channels(websocketpp::log::elevel::all);
-        m_wss_endpoint.init_asio();
-        m_wss_endpoint.set_tls_init_handler(websocketpp::lib::bind(&WsConnection::on_tls_init));
-        m_wss_endpoint.start_perpetual();
-        m_thread = std::make_shared<std::thread>(&wss_client::run, &m_wss_endpoint);
+        m_wss_endpoint = std::make_shared<wss_client>();
+        m_wss_endpoint->clear_access_channels(websocketpp::log::alevel::all);
+        m_wss_endpoint->clear_error_channels(websocketpp::log::elevel::all);
+        m_wss_endpoint->init_asio(&m_io.io);
+        m_wss_endpoint->set_tls_init_handler(websocketpp::lib::bind(&WsConnection::on_tls_init));
     } else {
-        m_ws_endpoint.clear_access_channels(websocketpp::log::alevel::all);
-        m_ws_endpoint.clear_error_channels(websocketpp::log::elevel::all);
-        m_ws_endpoint.init_asio();
-        m_ws_endpoint.start_perpetual();
-        m_thread = std::make_shared<std::thread>(&ws_client::run, &m_ws_endpoint);
+        m_ws_endpoint = std::make_shared<ws_client>();
+        m_ws_endpoint->clear_access_channels(websocketpp::log::alevel::all);
+        m_ws_endpoint->clear_error_channels(websocketpp::log::elevel::all);
+        m_ws_endpoint->init_asio(&m_io.io);
     }
 };
 
 WsConnection::~WsConnection() {
-    disconnect();
-    if (m_enable_tls) {
-        m_wss_endpoint.stop_perpetual();
+    // The io thread is shared with other connections, so it can't be joined: instead the
+    // connection is closed on it and its handlers are dropped, so nothing already queued on the
+    // io_service calls back into this object once it's gone.
+    auto shutdown = [this]() {
+        m_alive.reset();
+        m_http.reset();
+        m_reevaluation_timer.reset();
+        m_reconnect_timer.reset();
+        m_heartbeat_timer.reset();
+        m_on_open = NULL;
+        m_on_message = NULL;
+        m_on_standby_open = NULL;
+        m_status = ConnectionStatus::TERMINATED_BY_USER;
+        close_standby();
+        m_standby_timer.reset();
+        abandon_connection(m_hdl);
+    };
+
+    if (on_io_thread()) {
+        shutdown();
     } else {
-        m_ws_endpoint.stop_perpetual();
+        std::promise<void> done;
+        m_io.io.post([&]() {
+            shutdown();
+            done.set_value();
+        });
+        done.get_future().wait();
     }
-    m_thread->join();
 
     BASED_LOG("Destroyed WsConnection obj");
 };
 
-std::string WsConnection::discover_service(BasedConnectOpt opts, bool http) {
-    std::string url;
-    if (m_opts.url.length() > 0) {
-        url = opts.url;
-        if (http && (url.rfind("wss://", 0) == 0)) {
-            url.replace(0, 3, "https");
+void WsConnection::discover_service(
+    BasedConnectOpt opts,
+    bool http,
+    int max_attempts,
+    std::function<void(const std::string& /*url*/, const std::string& /*error*/)> cb) {
+    discover_hubs(opts, http, max_attempts,
+                  [cb](const std::vector<std::string>& urls, const std::string& error) {
+                      cb(urls.empty() ? "" : urls.front(), error);
+                  });
+}
+
+void WsConnection::discover_hubs(
+    BasedConnectOpt opts,
+    bool http,
+    int max_attempts,
+    std::function<void(const std::vector<std::string>& /*urls*/, const std::string& /*error*/)>
+        cb,
+    uint64_t connect_attempt) {
+    std::weak_ptr<bool> alive = m_alive;
+    m_io.io.post([this, alive, opts, http, max_attempts, cb, connect_attempt]() {
+        if (alive.expired()) return;
+
+        if (opts.url.length() > 0) {
+            std::string url = opts.url;
+            if (http && (url.rfind("wss://", 0) == 0)) {
+                url.replace(0, 3, "https");
+            }
+            cb({url}, "");
+            return;
         }
-        return url;
-    }
-    std::string discovery_url = gen_discovery_url(opts);
-    if (!m_opts.discovery_url.empty()) {
-        discovery_url = m_opts.discovery_url;
-    }
-    auto req = make_request(discovery_url, opts);
-    auto service_url = req.first;
-    auto access_key = req.second;
-    url = service_url;
-    if (m_enable_tls) {
-        return http ? "https://" + url : "wss://" + url + "/" + access_key;
-    } else {
-        return http ? "http://" + url : "ws://" + url + "/" + access_key;
-    }
+        std::string discovery_url = gen_discovery_url(opts);
+        if (!opts.discovery_url.empty()) {
+            discovery_url = opts.discovery_url;
+        } else if (!m_opts.discovery_url.empty()) {
+            discovery_url = m_opts.discovery_url;
+        }
+
+        bool tls = m_enable_tls;
+        request_hubs(
+            discovery_url, opts, max_attempts, 0,
+            [this, alive, tls, http, cb](const std::vector<std::string>& hubs,
+                                         const std::string& error) {
+                if (!error.empty()) {
+                    cb({}, error);
+                    return;
+                }
+                auto on_ranked = [alive, tls, http, cb](const std::vector<std::string>& ranked) {
+                    if (alive.expired()) return;
+                    std::vector<std::string> urls;
+                    for (auto& hub : ranked) {
+                        // hub is "<host>/<access key>"
+                        std::string host = hub.substr(0, hub.find('/'));
+                        if (tls) {
+                            urls.push_back(http ? "https://" + host : "wss://" + hub);
+                        } else {
+                            urls.push_back(http ? "http://" + host : "ws://" + hub);
+                        }
+                    }
+                    cb(urls, "");
+                };
+                HubProbe::run(m_io.io, hubs, tls ? "443" : "80",
+                              std::chrono::milliseconds(BASED_HUB_PROBE_TIMEOUT_MS), on_ranked);
+            },
+            connect_attempt);
+    });
 }
 
 void WsConnection::connect(std::string cluster,
@@ -271,30 +441,236 @@ void WsConnection::connect(std::string cluster,
                            bool optional_key,
                            std::string host,
                            std::string discovery_url) {
-    m_opts.cluster = cluster;
-    m_opts.org = org;
-    m_opts.project = project;
-    m_opts.env = env;
-    m_opts.name = "@based/env-hub";
-    m_opts.key = key;
-    m_opts.optional_key = optional_key;
-    m_opts.host = host;
-    m_opts.discovery_url = discovery_url;
-
-    std::thread con_thr([&]() {
-        std::string service_url = discover_service(m_opts, false);
-        connect_to_uri(service_url);
+    BasedConnectOpt opts;
+    opts.cluster = cluster;
+    opts.org = org;
+    opts.project = project;
+    opts.env = env;
+    opts.name = "@based/env-hub";
+    opts.key = key;
+    opts.optional_key = optional_key;
+    opts.host = host;
+    opts.discovery_url = discovery_url;
+
+    std::weak_ptr<bool> alive = m_alive;
+    m_io.io.post([this, alive, opts]() {
+        if (alive.expired()) return;
+        m_opts = opts;
+        start_connect();
+    });
+}
+
+void WsConnection::start_connect() {
+    // A disconnect, or another connect, before discovery is done makes this one obsolete
+    uint64_t attempt = ++m_connect_attempt;
+
+    m_cache_key = cache_key(m_opts, m_enable_tls);
+    m_hubs.clear();
+    m_hub_index = -1;
+    m_discovery_pending = true;
+
+    // Connect to the last hub right away, discovery only matters if it's gone.
+    std::string cached = DiscoveryCache::get().lookup(m_cache_key);
+    m_speculative = !cached.empty();
+    if (m_speculative) {
+        BASED_LOG("Connecting to cached hub \"%s\" while discovery runs", cached.c_str());
+        schedule_connect(cached);
+    }
+
+    // With a cached hub the discovery is only a fallback, it doesn't need to insist
+    int max_attempts = m_speculative ? BASED_SPECULATIVE_DISCOVERY_ATTEMPTS : 0;
+    discover_hubs(
+        m_opts, false, max_attempts,
+        [this, attempt, max_attempts](const std::vector<std::string>& urls,
+                                      const std::string& error) {
+            if (!error.empty()) BASED_LOG("%s", error.c_str());
+            if (attempt != m_connect_attempt) return;
+            m_discovery_pending = false;
+            m_hubs = urls;
+            m_hub_index = -1;
+            if (urls.empty()) {
+                // The cached hub starts over once it fails
+                if (m_speculative || m_status == ConnectionStatus::OPEN) return;
+                if (max_attempts == 0) {
+                    // Without a limit discovery only gives up when retrying can't help
+                    m_status = ConnectionStatus::FAILED;
+                    return;
+                }
+                // The cached hub failed while the discovery gave up
+                retry_connect();
+                return;
+            }
+            // the cached hub may have opened before the other hubs were known
+            open_standby();
+            // A connection that is already up or on its way stays, m_hub_index is left before
+            // the fastest hub for when it fails.
+            if (m_speculative || m_status == ConnectionStatus::OPEN ||
+                m_status == ConnectionStatus::CONNECTING) {
+                return;
+            }
+            next_hub(false);
+        },
+        attempt);
+}
+
+void WsConnection::retry_connect() {
+    m_reconnect_attempts++;
+    uint32_t delay = backoff_delay(m_reconnect_attempts);
+    BASED_LOG("Discovery failed, starting over in %u ms", delay);
+
+    uint64_t attempt = m_connect_attempt;
+    std::weak_ptr<bool> alive = m_alive;
+    m_reconnect_timer->cancel();
+    m_reconnect_timer->expires_after(std::chrono::milliseconds(delay));
+    m_reconnect_timer->async_wait([this, alive, attempt](const asio::error_code& ec) {
+        if (ec || alive.expired() || attempt != m_connect_attempt) return;
+        start_connect();
+    });
+}
+
+bool WsConnection::next_hub(bool skip_current) {
+    // The hub that just failed can be in the list, when it came from the cache
+    for (int i = m_hub_index + 1; i < (int)m_hubs.size(); i++) {
+        if (skip_current && m_hubs[i] == m_uri) continue;
+        m_hub_index = i;
+        schedule_connect(m_hubs[i]);
+        return true;
+    }
+    m_hub_index = m_hubs.size();
+    return false;
+}
+
+void WsConnection::drop_cached_hub() {
+    BASED_LOG("Cached hub \"%s\" failed", m_uri.c_str());
+    m_speculative = false;
+    DiscoveryCache::get().invalidate(m_cache_key);
+
+    if (m_discovery_pending) return;  // discovery connects when it's done
+    if (!next_hub(true)) {
+        // discovery gave up, start over without the cache
+        start_connect();
+    }
+}
+
+void WsConnection::set_hub_reevaluation(uint32_t interval_ms) {
+    std::weak_ptr<bool> alive = m_alive;
+    m_io.io.post([this, alive, interval_ms]() {
+        if (alive.expired()) return;
+        m_reevaluation_ms = interval_ms;
+        schedule_reevaluation();
+    });
+}
+
+void WsConnection::schedule_reevaluation() {
+    m_reevaluation_timer->cancel();
+    if (m_reevaluation_ms == 0) return;
+
+    std::weak_ptr<bool> alive = m_alive;
+    m_reevaluation_timer->expires_after(std::chrono::milliseconds(m_reevaluation_ms));
+    m_reevaluation_timer->async_wait([this, alive](const asio::error_code& ec) {
+        if (ec || alive.expired()) return;
+        reevaluate_hubs();
     });
-    con_thr.detach();
+}
+
+void WsConnection::reevaluate_hubs() {
+    // Only connections that went through discovery have hubs to choose from
+    if (m_status != ConnectionStatus::OPEN || m_opts.name.empty() || !m_opts.url.empty()) {
+        schedule_reevaluation();
+        return;
+    }
+
+    uint64_t attempt = m_connect_attempt;
+    discover_hubs(m_opts, false, BASED_SPECULATIVE_DISCOVERY_ATTEMPTS,
+                  [this, attempt](const std::vector<std::string>& urls, const std::string&) {
+                      schedule_reevaluation();
+                      if (attempt != m_connect_attempt || urls.empty()) return;
+
+                      // The open connection is kept, the new ranking is for the next reconnect
+                      // and for the clients that start next.
+                      m_hubs.clear();
+                      for (auto& url : urls) {
+                          if (url != m_uri) m_hubs.push_back(url);
+                      }
+                      m_hub_index = -1;
+                      open_standby();
+                      if (urls.front() != m_uri) {
+                          BASED_LOG("Hub \"%s\" is now closer than \"%s\"", urls.front().c_str(),
+                                    m_uri.c_str());
+                          DiscoveryCache::get().store(m_cache_key, urls.front());
+                      }
+                  },
+                  attempt);
 }
 
 void WsConnection::connect_to_uri(std::string uri) {
-    // maximum timeout between attempts, in ms
-    int timeout = m_reconnect_attempts > 15 ? 1500 : m_reconnect_attempts * 100;
+    std::weak_ptr<bool> alive = m_alive;
+    m_io.io.post([this, alive, uri]() {
+        if (alive.expired()) return;
+        // A new target, whatever was scheduled before is obsolete
+        m_connect_attempt++;
+        m_reconnect_timer->cancel();
+        open_uri(uri);
+    });
+}
+
+void WsConnection::set_reconnect_options(uint32_t base_ms, double multiplier, uint32_t max_ms) {
+    std::weak_ptr<bool> alive = m_alive;
+    m_io.io.post([this, alive, base_ms, multiplier, max_ms]() {
+        if (alive.expired()) return;
+        m_backoff_base_ms = base_ms;
+        m_backoff_multiplier = multiplier < 1 ? 1 : multiplier;
+        m_backoff_max_ms = max_ms;
+    });
+}
+
+std::string WsConnection::reconnect_stats() {
+    json stats = {
+        {"attempts", m_stats_attempts.load()},
+        {"reconnects", m_stats_reconnects.load()},
+        {"consecutiveFailures", m_stats_consecutive.load()},
+        {"lastDelayMs", m_stats_last_delay_ms.load()},
+        {"failovers", m_stats_failovers.load()},
+    };
+    return stats.dump();
+}
+
+uint32_t WsConnection::backoff_delay(int attempts) {
+    if (attempts <= 0) return 0;
+    // Full jitter: anywhere between 0 and the exponential cap, so clients that lost the same
+    // hub at the same time don't come back in lockstep.
+    double cap = m_backoff_base_ms * std::pow(m_backoff_multiplier, attempts - 1);
+    if (cap > m_backoff_max_ms) cap = m_backoff_max_ms;
+    return std::uniform_int_distribution<uint32_t>(0, (uint32_t)cap)(random_engine());
+}
+
+void WsConnection::schedule_connect(std::string uri) {
+    m_reconnect_timer->cancel();
+
+    uint32_t delay = backoff_delay(m_reconnect_attempts);
     if (m_reconnect_attempts > 0) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(timeout));
+        m_stats_attempts++;
+        m_stats_consecutive = m_reconnect_attempts;
+        m_stats_last_delay_ms = delay;
+    }
+    if (delay == 0) {
+        open_uri(uri);
+        return;
     }
 
+    BASED_LOG("Reconnecting to \"%s\" in %u ms (attempt %d)", uri.c_str(), delay,
+              m_reconnect_attempts);
+    // A connect or disconnect in the meantime cancels it
+    uint64_t attempt = m_connect_attempt;
+    std::weak_ptr<bool> alive = m_alive;
+    m_reconnect_timer->expires_after(std::chrono::milliseconds(delay));
+    m_reconnect_timer->async_wait([this, alive, attempt, uri](const asio::error_code& ec) {
+        if (ec || alive.expired() || attempt != m_connect_attempt) return;
+        open_uri(uri);
+    });
+}
+
+void WsConnection::open_uri(std::string uri) {
     if (m_status == ConnectionStatus::OPEN) {
         BASED_LOG("Attempting to connect while connection is already open, do nothing...");
         return;
@@ -302,10 +678,12 @@ void WsConnection::connect_to_uri(std::string uri) {
     BASED_LOG("Attempting to connect to \"%s\"", uri.c_str());
 
     m_uri = uri;
+    m_promoted = false;
+    m_failed_over_uri = "";
     websocketpp::lib::error_code ec;
 
     if (m_enable_tls) {
-        wss_client::connection_ptr con = m_wss_endpoint.get_connection(m_uri, ec);
+        wss_client::connection_ptr con = m_wss_endpoint->get_connection(m_uri, ec);
 
         if (ec) {
             BASED_LOG("Error trying to initialize connection, message = \"%s\"",
@@ -324,10 +702,10 @@ void WsConnection::connect_to_uri(std::string uri) {
 
         set_handlers(con);
 
-        m_wss_endpoint.connect(con);
+        m_wss_endpoint->connect(con);
 
     } else {
-        ws_client::connection_ptr con = m_ws_endpoint.get_connection(m_uri, ec);
+        ws_client::connection_ptr con = m_ws_endpoint->get_connection(m_uri, ec);
 
         if (ec) {
             BASED_LOG("Error trying to initialize connection, message = \"%s\"",
@@ -346,61 +724,97 @@ void WsConnection::connect_to_uri(std::string uri) {
 
         set_handlers(con);
 
-        m_ws_endpoint.connect(con);
+        m_ws_endpoint->connect(con);
     }
 };
 
 void WsConnection::set_open_handler(std::function<void()> on_open) {
     m_on_open = on_open;
 };
-void WsConnection::set_message_handler(std::function<void(std::string)> on_message) {
+void WsConnection::set_message_handler(
+    std::function<void(const std::string&)> on_message) {
     m_on_message = on_message;
 };
 
 void WsConnection::disconnect() {
-    if (m_status != ConnectionStatus::OPEN) {
-        return;
-    }
-
-    BASED_LOG("Connection terminated by user, closing...");
+    m_connect_attempt++;
+    std::weak_ptr<bool> alive = m_alive;
+    // The handle and the status belong to the io thread, the close is done there too.
+    m_io.io.post([this, alive]() {
+        if (alive.expired()) return;
+        close_standby();
+        if (m_status != ConnectionStatus::OPEN) {
+            return;
+        }
 
-    m_status = ConnectionStatus::TERMINATED_BY_USER;
+        BASED_LOG("Connection terminated by user, closing...");
 
-    websocketpp::lib::error_code ec;
-    if (m_enable_tls) {
-        m_wss_endpoint.close(m_hdl, websocketpp::close::status::going_away, "", ec);
-    } else {
-        m_ws_endpoint.close(m_hdl, websocketpp::close::status::going_away, "", ec);
-    }
-    if (ec) {
-        BASED_LOG("Error trying to close connection, message = \"%s\"", ec.message().c_str());
+        m_status = ConnectionStatus::TERMINATED_BY_USER;
 
-        return;
-    }
+        websocketpp::lib::error_code ec;
+        if (m_enable_tls) {
+            m_wss_endpoint->close(m_hdl, websocketpp::close::status::going_away, "", ec);
+        } else {
+            m_ws_endpoint->close(m_hdl, websocketpp::close::status::going_away, "", ec);
+        }
+        if (ec) {
+            BASED_LOG("Error trying to close connection, message = \"%s\"",
+                      ec.message().c_str());
+        }
+    });
 };
 
-void WsConnection::send(std::vector<uint8_t> message) {
+void WsConnection::send(const std::vector<uint8_t>& message) {
     websocketpp::lib::error_code ec;
 
     if (m_status != ConnectionStatus::OPEN) throw(std::runtime_error("Connection is not open."));
 
     if (m_enable_tls) {
-        m_wss_endpoint.send(m_hdl, message.data(), message.size(),
+        m_wss_endpoint->send(m_hdl, message.data(), message.size(),
                             websocketpp::frame::opcode::binary, ec);
     } else {
-        m_ws_endpoint.send(m_hdl, message.data(), message.size(),
+        m_ws_endpoint->send(m_hdl, message.data(), message.size(),
                            websocketpp::frame::opcode::binary, ec);
     }
     if (ec) {
         BASED_LOG("Error trying to send message, message = \"%s\"", ec.message().c_str());
         return;
     }
+    buffered_amount();
 };
 
 ConnectionStatus WsConnection::status() {
     return m_status;
 };
 
+asio::io_service& WsConnection::get_io_service() {
+    return m_io.io;
+}
+
+size_t WsConnection::buffered_amount() {
+    size_t amount = 0;
+    if (m_status == ConnectionStatus::OPEN) {
+        websocketpp::lib::error_code ec;
+        if (m_enable_tls) {
+            auto con = m_wss_endpoint->get_con_from_hdl(m_hdl, ec);
+            if (!ec) amount = con->get_buffered_amount();
+        } else {
+            auto con = m_ws_endpoint->get_con_from_hdl(m_hdl, ec);
+            if (!ec) amount = con->get_buffered_amount();
+        }
+    }
+    m_buffered_snapshot = amount;
+    return amount;
+}
+
+size_t WsConnection::buffered_amount_snapshot() {
+    return m_buffered_snapshot;
+}
+
+bool WsConnection::on_io_thread() {
+    return m_io.running_in_this_thread();
+}
+
 using context_ptr = std::shared_ptr<asio::ssl::context>;
 context_ptr WsConnection::on_tls_init() {
     context_ptr ctx = std::make_shared<asio::ssl::context>(asio::ssl::context::sslv23);
@@ -415,104 +829,405 @@ context_ptr WsConnection::on_tls_init() {
     return ctx;
 }
 
+void WsConnection::handle_open() {
+    BASED_LOG("Connection opened");
+    m_status = ConnectionStatus::OPEN;
+    m_reconnect_attempts = 0;
+    m_stats_consecutive = 0;
+    if (m_opened) m_stats_reconnects++;
+    m_opened = true;
+    m_speculative = false;
+    m_ping_outstanding = false;
+    m_missed_pongs = 0;
+    schedule_heartbeat();
+    if (!m_cache_key.empty()) {
+        DiscoveryCache::get().store(m_cache_key, m_uri);
+    }
+    if (m_on_open) {
+        m_on_open();
+    }
+    open_standby();
+}
+
+void WsConnection::handle_close() {
+    if (m_status == ConnectionStatus::TERMINATED_BY_USER) return;
+
+    m_status = ConnectionStatus::CLOSED;
+    m_buffered_snapshot = 0;
+    if (promote_standby()) return;
+    m_reconnect_attempts++;
+
+    if (m_speculative) {
+        // closed before it even opened
+        drop_cached_hub();
+    } else if (!m_hubs.empty()) {
+        // the next fastest hub, discovery runs again once they all failed
+        if (!next_hub(true)) start_connect();
+    } else if (!m_opts.name.empty()) {
+        start_connect();
+    } else {
+        schedule_connect(m_uri);
+    }
+}
+
+void WsConnection::handle_fail() {
+    BASED_LOG("Received FAIL event");
+    m_status = ConnectionStatus::FAILED;
+    m_buffered_snapshot = 0;
+    if (promote_standby()) return;
+    m_reconnect_attempts++;
+
+    if (m_speculative) {
+        drop_cached_hub();
+    } else if (!m_hubs.empty()) {
+        if (!next_hub(true)) start_connect();
+    } else if (m_uri.size() == 0) {
+        start_connect();
+    } else {
+        schedule_connect(m_uri);
+    }
+}
+
+void WsConnection::abandon_connection(websocketpp::connection_hdl hdl) {
+    websocketpp::lib::error_code ec;
+    if (m_enable_tls) {
+        auto con = m_wss_endpoint->get_con_from_hdl(hdl, ec);
+        if (!ec) clear_handlers(con, m_wss_endpoint);
+    } else {
+        auto con = m_ws_endpoint->get_con_from_hdl(hdl, ec);
+        if (!ec) clear_handlers(con, m_ws_endpoint);
+    }
+    if (ec) return;
+
+    if (m_enable_tls) {
+        m_wss_endpoint->close(hdl, websocketpp::close::status::going_away, "", ec);
+    } else {
+        m_ws_endpoint->close(hdl, websocketpp::close::status::going_away, "", ec);
+    }
+}
+
+void WsConnection::set_standby(bool enabled) {
+    std::weak_ptr<bool> alive = m_alive;
+    m_io.io.post([this, alive, enabled]() {
+        if (alive.expired()) return;
+        m_standby_enabled = enabled;
+        if (enabled) {
+            open_standby();
+        } else {
+            close_standby();
+        }
+    });
+}
+
+void WsConnection::set_standby_open_handler(std::function<void()> on_standby_open) {
+    m_on_standby_open = on_standby_open;
+}
+
+void WsConnection::send_standby(const std::vector<uint8_t>& message) {
+    if (m_standby_status != ConnectionStatus::OPEN) return;
+
+    websocketpp::lib::error_code ec;
+    if (m_enable_tls) {
+        m_wss_endpoint->send(m_standby_hdl, message.data(), message.size(),
+                             websocketpp::frame::opcode::binary, ec);
+    } else {
+        m_ws_endpoint->send(m_standby_hdl, message.data(), message.size(),
+                            websocketpp::frame::opcode::binary, ec);
+    }
+    if (ec) {
+        BASED_LOG("Error sending to the standby, message = \"%s\"", ec.message().c_str());
+    }
+}
+
+bool WsConnection::promoted_standby() {
+    return m_promoted;
+}
+
+void WsConnection::open_standby() {
+    if (!m_standby_enabled || m_status != ConnectionStatus::OPEN ||
+        m_standby_status != ConnectionStatus::CLOSED) {
+        return;
+    }
+
+    // The fastest hub other than the primary's, a standby on the same hub would fail with it.
+    // The hub the primary just failed over from only comes last.
+    auto it = std::find_if(m_hubs.begin(), m_hubs.end(), [this](const std::string& hub) {
+        return hub != m_uri && hub != m_failed_over_uri;
+    });
+    if (it == m_hubs.end()) {
+        it = std::find_if(m_hubs.begin(), m_hubs.end(),
+                          [this](const std::string& hub) { return hub != m_uri; });
+    }
+    if (it == m_hubs.end()) {
+        BASED_LOG("No other hub for a standby connection");
+        return;
+    }
+
+    BASED_LOG("Opening standby connection to \"%s\"", it->c_str());
+    if (m_enable_tls) {
+        open_standby_on(m_wss_endpoint, *it);
+    } else {
+        open_standby_on(m_ws_endpoint, *it);
+    }
+}
+
+template <typename endpoint_ptr>
+void WsConnection::open_standby_on(endpoint_ptr endpoint, const std::string& uri) {
+    websocketpp::lib::error_code ec;
+    auto con = endpoint->get_connection(uri, ec);
+    if (ec) {
+        BASED_LOG("Error trying to initialize standby connection, message = \"%s\"",
+                  ec.message().c_str());
+        return;
+    }
+    con->append_header("sec-websocket-protocol", "{}");
+
+    // Nothing is subscribed on the standby, so it has no message handler.
+    con->set_open_handler([this](websocketpp::connection_hdl) { handle_standby_open(); });
+    con->set_close_handler([this](websocketpp::connection_hdl) { handle_standby_lost(); });
+    con->set_fail_handler([this](websocketpp::connection_hdl) { handle_standby_lost(); });
+
+    m_standby_hdl = con->get_handle();
+    m_standby_uri = uri;
+    m_standby_status = ConnectionStatus::CONNECTING;
+    endpoint->connect(con);
+}
+
+void WsConnection::close_standby() {
+    if (m_standby_status == ConnectionStatus::CLOSED) return;
+    m_standby_timer->cancel();
+    abandon_connection(m_standby_hdl);
+    m_standby_status = ConnectionStatus::CLOSED;
+    m_standby_uri = "";
+}
+
+void WsConnection::handle_standby_open() {
+    BASED_LOG("Standby connection to \"%s\" opened", m_standby_uri.c_str());
+    m_standby_status = ConnectionStatus::OPEN;
+    if (m_on_standby_open) {
+        m_on_standby_open();
+    }
+}
+
+void WsConnection::handle_standby_lost() {
+    BASED_LOG("Standby connection to \"%s\" lost", m_standby_uri.c_str());
+    m_standby_status = ConnectionStatus::CLOSED;
+    m_standby_uri = "";
+
+    // Not retried right away, the hub may be down for a while
+    std::weak_ptr<bool> alive = m_alive;
+    m_standby_timer->expires_after(std::chrono::milliseconds(BASED_STANDBY_RETRY_MS));
+    m_standby_timer->async_wait([this, alive](const asio::error_code& ec) {
+        if (ec || alive.expired()) return;
+        open_standby();
+    });
+}
+
+bool WsConnection::promote_standby() {
+    if (m_standby_status != ConnectionStatus::OPEN) return false;
+
+    BASED_LOG("Failing over from \"%s\" to the standby \"%s\"", m_uri.c_str(),
+              m_standby_uri.c_str());
+    websocketpp::lib::error_code ec;
+    if (m_enable_tls) {
+        auto con = m_wss_endpoint->get_con_from_hdl(m_standby_hdl, ec);
+        if (!ec) set_handlers(con);
+    } else {
+        auto con = m_ws_endpoint->get_con_from_hdl(m_standby_hdl, ec);
+        if (!ec) set_handlers(con);
+    }
+    if (ec) {
+        m_standby_status = ConnectionStatus::CLOSED;
+        return false;
+    }
+
+    // Whatever was in progress for the old primary is obsolete
+    m_connect_attempt++;
+    m_reconnect_timer->cancel();
+    m_failed_over_uri = m_uri;
+    m_hdl = m_standby_hdl;
+    m_uri = m_standby_uri;
+    m_standby_status = ConnectionStatus::CLOSED;
+    m_standby_uri = "";
+    m_stats_failovers++;
+
+    m_promoted = true;
+    handle_open();
+    return true;
+}
+
+void WsConnection::set_heartbeat(uint32_t interval_ms, uint32_t max_missed) {
+    std::weak_ptr<bool> alive = m_alive;
+    m_io.io.post([this, alive, interval_ms, max_missed]() {
+        if (alive.expired()) return;
+        m_ping_interval_ms = interval_ms;
+        m_max_missed_pongs = max_missed ? max_missed : 1;
+        if (m_status == ConnectionStatus::OPEN) schedule_heartbeat();
+    });
+}
+
+std::string WsConnection::heartbeat_stats() {
+    std::lock_guard<std::mutex> lock(m_rtt_mutex);
+    json histogram = json::array();
+    for (size_t i = 0; i < RTT_BUCKETS; i++) {
+        json bucket = {{"count", m_rtt_histogram[i]}};
+        // the last bucket has no upper bound
+        if (i < RTT_BUCKETS - 1) bucket["leMs"] = RTT_BUCKET_BOUNDS_MS[i];
+        histogram.push_back(bucket);
+    }
+    json stats = {
+        {"pings", m_pings_sent},
+        {"pongs", m_pongs},
+        {"missed", m_missed_total},
+        {"deadLinks", m_dead_links},
+        {"rttMs", m_rtt_last_ms},
+        {"rttEwmaMs", m_rtt_ewma_ms},
+        {"histogram", histogram},
+    };
+    return stats.dump();
+}
+
+void WsConnection::schedule_heartbeat() {
+    m_heartbeat_timer->cancel();
+    if (m_ping_interval_ms == 0) return;
+
+    std::weak_ptr<bool> alive = m_alive;
+    m_heartbeat_timer->expires_after(std::chrono::milliseconds(m_ping_interval_ms));
+    m_heartbeat_timer->async_wait([this, alive](const asio::error_code& ec) {
+        if (ec || alive.expired()) return;
+        heartbeat();
+    });
+}
+
+void WsConnection::heartbeat() {
+    if (m_status != ConnectionStatus::OPEN) return;
+    // Writes finish in the background, the snapshot catches up at least once per interval.
+    buffered_amount();
+
+    if (m_ping_outstanding) {
+        m_missed_pongs++;
+        {
+            std::lock_guard<std::mutex> lock(m_rtt_mutex);
+            m_missed_total++;
+        }
+        if (m_missed_pongs >= m_max_missed_pongs) {
+            drop_dead_link();
+            return;
+        }
+    }
+
+    // A pong answering an older ping doesn't count, its rtt would include the wait.
+    m_ping_seq++;
+    websocketpp::lib::error_code ec;
+    if (m_enable_tls) {
+        m_wss_endpoint->ping(m_hdl, std::to_string(m_ping_seq), ec);
+    } else {
+        m_ws_endpoint->ping(m_hdl, std::to_string(m_ping_seq), ec);
+    }
+    if (ec) {
+        BASED_LOG("Error sending ping, message = \"%s\"", ec.message().c_str());
+    } else {
+        m_ping_outstanding = true;
+        m_ping_sent = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> lock(m_rtt_mutex);
+        m_pings_sent++;
+    }
+    schedule_heartbeat();
+}
+
+void WsConnection::handle_pong(const std::string& payload) {
+    if (!m_ping_outstanding || payload != std::to_string(m_ping_seq)) return;
+    m_ping_outstanding = false;
+    m_missed_pongs = 0;
+
+    double rtt =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_ping_sent)
+            .count();
+
+    std::lock_guard<std::mutex> lock(m_rtt_mutex);
+    m_pongs++;
+    m_rtt_last_ms = rtt;
+    m_rtt_ewma_ms =
+        m_pongs == 1 ? rtt : RTT_EWMA_ALPHA * rtt + (1 - RTT_EWMA_ALPHA) * m_rtt_ewma_ms;
+    size_t bucket = 0;
+    while (bucket < RTT_BUCKETS - 1 && rtt > RTT_BUCKET_BOUNDS_MS[bucket]) bucket++;
+    m_rtt_histogram[bucket]++;
+}
+
+void WsConnection::drop_dead_link() {
+    BASED_LOG("No pong for %u pings, dropping the connection to \"%s\"", m_missed_pongs,
+              m_uri.c_str());
+    {
+        std::lock_guard<std::mutex> lock(m_rtt_mutex);
+        m_dead_links++;
+    }
+    // The closing handshake can't complete on a dead link, so the connection is left to time
+    // out on its own while a new one is made right away.
+    m_heartbeat_timer->cancel();
+    abandon_connection(m_hdl);
+    handle_close();
+}
+
+template <typename connection_ptr>
+void WsConnection::clear_handlers(connection_ptr con, std::shared_ptr<void> endpoint) {
+    // The connection calls back into the endpoint when it terminates, which happens after the
+    // closing handshake, so the last handler it runs keeps the endpoint alive until then.
+    auto keep_alive = [endpoint](websocketpp::connection_hdl) {};
+    con->set_open_handler(nullptr);
+    con->set_message_handler(nullptr);
+    con->set_pong_handler(nullptr);
+    con->set_close_handler(keep_alive);
+    con->set_fail_handler(keep_alive);
+}
+
 void WsConnection::set_handlers(ws_client::connection_ptr con) {
     // bind must be used if the function we're binding to doest have the right number of
     // arguments (hence the placeholders) these handlers must be set before calling connect, and
     // can't be changed after (i think)
-    con->set_open_handler([this](websocketpp::connection_hdl) {
-        BASED_LOG("Connection opened");
-        m_status = ConnectionStatus::OPEN;
-        m_reconnect_attempts = 0;
-        if (m_on_open) {
-            m_on_open();
-        }
-    });
+    con->set_open_handler([this](websocketpp::connection_hdl) { handle_open(); });
 
     con->set_message_handler([this](websocketpp::connection_hdl hdl, ws_client::message_ptr msg) {
         // here we will pass the message to the decoder, which, based on the header, will
         // call the appropriate callback
 
-        std::string payload = msg->get_payload();
+        // The payload is passed by reference, it's only valid until the handler returns.
+        // anything received proves the link is alive
+        m_missed_pongs = 0;
         if (m_on_message) {
-            m_on_message(payload);
+            m_on_message(msg->get_payload());
         }
     });
 
-    con->set_close_handler([this](websocketpp::connection_hdl) {
-        if (m_status != ConnectionStatus::TERMINATED_BY_USER) {
-            m_status = ConnectionStatus::CLOSED;
-            m_reconnect_attempts++;
-
-            if (!m_opts.name.empty()) {
-                connect(m_opts.cluster, m_opts.org, m_opts.project, m_opts.env, m_opts.key,
-                        m_opts.optional_key, m_opts.host, m_opts.discovery_url);
-            } else {
-                connect_to_uri(m_uri);
-            }
-        }
-    });
+    con->set_pong_handler(
+        [this](websocketpp::connection_hdl, std::string payload) { handle_pong(payload); });
 
-    con->set_fail_handler([this](websocketpp::connection_hdl) {
-        BASED_LOG("Received FAIL event");
-        m_status = ConnectionStatus::FAILED;
-        m_reconnect_attempts++;
+    con->set_close_handler([this](websocketpp::connection_hdl) { handle_close(); });
 
-        if (m_uri.size() == 0) {
-            connect(m_opts.cluster, m_opts.org, m_opts.project, m_opts.env, m_opts.key,
-                    m_opts.optional_key, m_opts.host, m_opts.discovery_url);
-        } else {
-            connect_to_uri(m_uri);
-        }
-    });
+    con->set_fail_handler([this](websocketpp::connection_hdl) { handle_fail(); });
 }
 
 void WsConnection::set_handlers(wss_client::connection_ptr con) {
     // bind must be used if the function we're binding to doest have the right number of
     // arguments (hence the placeholders) these handlers must be set before calling connect, and
     // can't be changed after (i think)
-    con->set_open_handler([this](websocketpp::connection_hdl) {
-        BASED_LOG("Connection opened");
-        m_status = ConnectionStatus::OPEN;
-        m_reconnect_attempts = 0;
-        if (m_on_open) {
-            m_on_open();
-        }
-    });
+    con->set_open_handler([this](websocketpp::connection_hdl) { handle_open(); });
 
     con->set_message_handler([this](websocketpp::connection_hdl hdl, wss_client::message_ptr msg) {
         // here we will pass the message to the decoder, which, based on the header, will
         // call the appropriate callback
 
-        std::string payload = msg->get_payload();
+        // The payload is passed by reference, it's only valid until the handler returns.
+        // anything received proves the link is alive
+        m_missed_pongs = 0;
         if (m_on_message) {
-            m_on_message(payload);
+            m_on_message(msg->get_payload());
         }
     });
 
-    con->set_close_handler([this](websocketpp::connection_hdl) {
-        if (m_status != ConnectionStatus::TERMINATED_BY_USER) {
-            m_status = ConnectionStatus::CLOSED;
-            m_reconnect_attempts++;
+    con->set_pong_handler(
+        [this](websocketpp::connection_hdl, std::string payload) { handle_pong(payload); });
 
-            if (!m_opts.name.empty()) {
-                connect(m_opts.cluster, m_opts.org, m_opts.project, m_opts.env, m_opts.key,
-                        m_opts.optional_key, m_opts.host, m_opts.discovery_url);
-            } else {
-                connect_to_uri(m_uri);
-            }
-        }
-    });
-
-    con->set_fail_handler([this](websocketpp::connection_hdl) {
-        BASED_LOG("Received FAIL event");
-        m_status = ConnectionStatus::FAILED;
-        m_reconnect_attempts++;
+    con->set_close_handler([this](websocketpp::connection_hdl) { handle_close(); });
 
-        if (m_uri.size() == 0) {
-            connect(m_opts.cluster, m_opts.org, m_opts.project, m_opts.env, m_opts.key,
-                    m_opts.optional_key, m_opts.host, m_opts.discovery_url);
-        } else {
-            connect_to_uri(m_uri);
-        }
-    });
+    con->set_fail_handler([this](websocketpp::connection_hdl) { handle_fail(); });
 }
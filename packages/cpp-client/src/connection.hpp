@@ -1,7 +1,12 @@
 #ifndef BASED_WS_CONNECTION_H
 #define BASED_WS_CONNECTION_H
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <websocketpp/client.hpp>
@@ -9,6 +14,9 @@
 #include <websocketpp/config/asio_client.hpp>         // SSL
 #include <websocketpp/config/asio_no_tls_client.hpp>  // No SSL
 
+#include "http.hpp"
+#include "iopool.hpp"
+
 typedef websocketpp::client<websocketpp::config::asio_tls_client> wss_client;  // SSL
 typedef websocketpp::client<websocketpp::config::asio_client> ws_client;       // No SSL
 
@@ -29,7 +37,6 @@ struct BasedConnectOpt {
 };
 
 class WsConnection {
-    // eventually there should be some logic here to handle inactivity.
    public:
     WsConnection(bool enable_tls);
     ~WsConnection();
@@ -42,13 +49,107 @@ class WsConnection {
                  bool optional_key,
                  std::string host,
                  std::string discovery_url);
+    /**
+     * @brief Connect to uri right away, on the io thread.
+     */
     void connect_to_uri(std::string uri);
+    /**
+     * @brief Close the connection and stop reconnecting, on the io thread.
+     */
     void disconnect();
     void set_open_handler(std::function<void()> on_open);
-    void set_message_handler(std::function<void(std::string)> on_message);
-    void send(std::vector<uint8_t> message);
+    void set_message_handler(std::function<void(const std::string&)> on_message);
+    void send(const std::vector<uint8_t>& message);
     ConnectionStatus status();
-    std::string discover_service(BasedConnectOpt opts, bool http);
+    /**
+     * @brief The io_service the connection runs on, for timers and handlers that must run on
+     * the io thread.
+     */
+    asio::io_service& get_io_service();
+    /**
+     * @brief Bytes handed to websocketpp that haven't been written to the socket yet, on the io
+     * thread. Also refreshes the snapshot read by buffered_amount_snapshot.
+     */
+    size_t buffered_amount();
+    /**
+     * @brief The buffered amount as of the last send or heartbeat, from any thread.
+     */
+    size_t buffered_amount_snapshot();
+    /**
+     * @brief Whether the caller is running on the io thread of this connection.
+     */
+    bool on_io_thread();
+    /**
+     * @brief Find the url of a service, without blocking. Failed requests are retried on a
+     * timer, with the same backoff as reconnections.
+     *
+     * @param max_attempts Give up after this many failed requests, 0 to retry until it works.
+     * @param cb Called on the io thread, with the url or an error.
+     */
+    void discover_service(
+        BasedConnectOpt opts,
+        bool http,
+        int max_attempts,
+        std::function<void(const std::string& /*url*/, const std::string& /*error*/)> cb);
+    /**
+     * @brief Like discover_service, but with all the hubs of the service, fastest first. They are
+     * ranked by how long a TCP connection to each of them takes, see HubProbe.
+     *
+     * @param connect_attempt The connect the hubs are for, the retries stop once a disconnect or
+     * another connect made it obsolete. 0 when it isn't for a connect.
+     */
+    void discover_hubs(
+        BasedConnectOpt opts,
+        bool http,
+        int max_attempts,
+        std::function<void(const std::vector<std::string>& /*urls*/,
+                           const std::string& /*error*/)> cb,
+        uint64_t connect_attempt = 0);
+    /**
+     * @brief Probe the hubs of the env again every interval_ms while connected, 0 (the default)
+     * to stop. The open connection stays where it is, the new ranking is used by the next
+     * reconnect, and stored in the DiscoveryCache for the next clients.
+     */
+    void set_hub_reevaluation(uint32_t interval_ms);
+    /**
+     * @brief Backoff between reconnect attempts: the delay before attempt n is random between 0
+     * and min(base_ms * multiplier^(n-1), max_ms).
+     */
+    void set_reconnect_options(uint32_t base_ms, double multiplier, uint32_t max_ms);
+    /**
+     * @brief Reconnect attempts, successful reconnects, the current run of failures, the last
+     * delay and the failovers to the standby, as json.
+     */
+    std::string reconnect_stats();
+    /**
+     * @brief Send a ping every interval_ms while open, 0 to stop, and reconnect once max_missed
+     * pings in a row went unanswered.
+     */
+    void set_heartbeat(uint32_t interval_ms, uint32_t max_missed);
+    /**
+     * @brief Pings, pongs, missed pongs, dropped dead links, and the round trip time: last,
+     * moving average and histogram, as json.
+     */
+    std::string heartbeat_stats();
+    /**
+     * @brief Keep a second connection open to another hub of the env while connected. When the
+     * primary connection is lost, the standby becomes the primary right away, instead of going
+     * through discovery and a new handshake.
+     */
+    void set_standby(bool enabled);
+    /**
+     * @brief Called on the io thread when a standby connection opens, to prepare it (with
+     * send_standby) for taking over.
+     */
+    void set_standby_open_handler(std::function<void()> on_standby_open);
+    /**
+     * @brief Send on the standby connection, from the io thread. Dropped if it isn't open.
+     */
+    void send_standby(const std::vector<uint8_t>& message);
+    /**
+     * @brief Whether the open connection used to be the standby, until the next connect.
+     */
+    bool promoted_standby();
 
     void set_handlers(ws_client::connection_ptr con);
     void set_handlers(wss_client::connection_ptr con);
@@ -58,20 +159,213 @@ class WsConnection {
 
    private:  // Members
     bool m_enable_tls;
-    ws_client m_ws_endpoint;
-    wss_client m_wss_endpoint;
+    /**
+     * Only the endpoint matching m_enable_tls exists. Shared so that a connection that is still
+     * closing can outlive this object.
+     */
+    std::shared_ptr<ws_client> m_ws_endpoint;
+    std::shared_ptr<wss_client> m_wss_endpoint;
     websocketpp::connection_hdl m_hdl;
-    ConnectionStatus m_status;
+    /**
+     * Only changed on the io thread, atomic so that status() can be read from any thread.
+     */
+    std::atomic<ConnectionStatus> m_status;
+    std::atomic<size_t> m_buffered_snapshot;
     std::string m_uri;
-    std::shared_ptr<std::thread> m_thread;
+    /**
+     * The io_service of the shared pool this connection runs on, all its handlers run on the
+     * thread of this io_service.
+     */
+    IoPool::Context& m_io;
     std::shared_future<void> m_reconnect_future;
     std::function<void()> m_on_open;
-    std::function<void(std::string)> m_on_message;
+    std::function<void(const std::string&)> m_on_message;
     int m_reconnect_attempts;
+    /**
+     * Incremented by every connect and disconnect, so a discovery that finishes after the
+     * connection was closed or connected somewhere else is ignored.
+     */
+    std::atomic<uint64_t> m_connect_attempt;
+    /**
+     * The discovery requests, only touched on the io thread.
+     */
+    std::unique_ptr<AsyncHttp> m_http;
+    /**
+     * Expires when the connection is destroyed, for the handlers still posted to the io thread.
+     */
+    std::shared_ptr<bool> m_alive;
+
+    /**
+     * Key of m_opts in the DiscoveryCache.
+     */
+    std::string m_cache_key;
+    /**
+     * The connection in progress is to a hub from the cache, not yet confirmed by discovery.
+     */
+    bool m_speculative;
+    bool m_discovery_pending;
+    /**
+     * The hubs from the last discovery, fastest first, where reconnects go before discovering
+     * again. Also the fallback if a speculative connection fails.
+     */
+    std::vector<std::string> m_hubs;
+    /**
+     * The last hub of m_hubs that was tried, -1 before the first one.
+     */
+    int m_hub_index;
+    /**
+     * Reset with m_http, on the io thread.
+     */
+    std::unique_ptr<asio::steady_timer> m_reevaluation_timer;
+    uint32_t m_reevaluation_ms;
+
+    /**
+     * The pending reconnect, reset with m_http.
+     */
+    std::unique_ptr<asio::steady_timer> m_reconnect_timer;
+    uint32_t m_backoff_base_ms;
+    double m_backoff_multiplier;
+    uint32_t m_backoff_max_ms;
+    bool m_opened;
+    /**
+     * Written on the io thread, read by reconnect_stats from any thread.
+     */
+    std::atomic<uint64_t> m_stats_attempts;
+    std::atomic<uint64_t> m_stats_reconnects;
+    std::atomic<int> m_stats_consecutive;
+    std::atomic<uint32_t> m_stats_last_delay_ms;
+
+    /**
+     * Pings are only sent while open, one at a time, with their sequence number as payload.
+     */
+    std::unique_ptr<asio::steady_timer> m_heartbeat_timer;
+    uint32_t m_ping_interval_ms;
+    uint32_t m_max_missed_pongs;
+    uint64_t m_ping_seq;
+    bool m_ping_outstanding;
+    std::chrono::steady_clock::time_point m_ping_sent;
+    uint32_t m_missed_pongs;
+
+    /**
+     * Upper bounds of the rtt histogram buckets, the last bucket holds everything above.
+     */
+    static const size_t RTT_BUCKETS = 11;
+    static const double RTT_BUCKET_BOUNDS_MS[RTT_BUCKETS - 1];
+    /**
+     * Guards the heartbeat stats, which are read from any thread.
+     */
+    std::mutex m_rtt_mutex;
+    double m_rtt_ewma_ms;
+    double m_rtt_last_ms;
+    std::array<uint64_t, RTT_BUCKETS> m_rtt_histogram;
+    uint64_t m_pings_sent;
+    uint64_t m_pongs;
+    uint64_t m_missed_total;
+    uint64_t m_dead_links;
+
+    /**
+     * The standby only exists while the primary is open, on the fastest other hub of m_hubs.
+     */
+    bool m_standby_enabled;
+    websocketpp::connection_hdl m_standby_hdl;
+    std::string m_standby_uri;
+    /**
+     * CLOSED, CONNECTING or OPEN.
+     */
+    ConnectionStatus m_standby_status;
+    std::unique_ptr<asio::steady_timer> m_standby_timer;
+    std::function<void()> m_on_standby_open;
+    bool m_promoted;
+    /**
+     * The hub of the primary before the last failover, the standby avoids it.
+     */
+    std::string m_failed_over_uri;
+    std::atomic<uint64_t> m_stats_failovers;
 
     BasedConnectOpt m_opts;
 
-    std::pair<std::string, std::string> make_request(std::string url, BasedConnectOpt opts);
+    /**
+     * @brief Connect with m_opts, on the io thread. Goes to the cached hub of the env right away
+     * if there's one, and runs discovery in parallel in case it's gone.
+     */
+    void start_connect();
+
+    /**
+     * @brief start_connect again after the reconnect backoff, when discovery gave up.
+     */
+    void retry_connect();
+
+    /**
+     * @brief The cached hub didn't work, move on to the one from discovery.
+     */
+    void drop_cached_hub();
+
+    /**
+     * @brief Connect to the next hub of m_hubs, false when there are none left.
+     *
+     * @param skip_current Don't try m_uri again.
+     */
+    bool next_hub(bool skip_current);
+
+    /**
+     * @brief Connect to uri once the backoff of m_reconnect_attempts has passed, on a timer so
+     * the io thread keeps running meanwhile.
+     */
+    void schedule_connect(std::string uri);
+    /**
+     * @brief Connect to uri now, on the io thread.
+     */
+    void open_uri(std::string uri);
+    uint32_t backoff_delay(int attempts);
+
+    void schedule_reevaluation();
+    void reevaluate_hubs();
+
+    void handle_open();
+    void handle_close();
+    void handle_fail();
+
+    void schedule_heartbeat();
+    void heartbeat();
+    void handle_pong(const std::string& payload);
+    /**
+     * @brief The pongs stopped coming, give up on the connection and reconnect.
+     */
+    void drop_dead_link();
+    /**
+     * @brief Close a connection without running any of its handlers.
+     */
+    void abandon_connection(websocketpp::connection_hdl hdl);
+
+    void open_standby();
+    template <typename endpoint_ptr>
+    void open_standby_on(endpoint_ptr endpoint, const std::string& uri);
+    void close_standby();
+    void handle_standby_open();
+    void handle_standby_lost();
+    /**
+     * @brief Make the standby the primary connection, false if there is no open standby.
+     */
+    bool promote_standby();
+
+    template <typename connection_ptr>
+    void clear_handlers(connection_ptr con, std::shared_ptr<void> endpoint);
+
+    /**
+     * @brief Ask the discovery service at url for its hubs, on the io thread. cb gets them as
+     * "<host>/<access key>", in random order, or an error after max_attempts, or right away if
+     * the service can't be discovered.
+     *
+     * @param attempt Failed attempts of this request so far, it's retried with its own backoff.
+     * @param connect_attempt See discover_hubs.
+     */
+    void request_hubs(
+        std::string url,
+        BasedConnectOpt opts,
+        int max_attempts,
+        int attempt,
+        std::function<void(const std::vector<std::string>&, const std::string&)> cb,
+        uint64_t connect_attempt);
 };
 
 #endif
\ No newline at end of file
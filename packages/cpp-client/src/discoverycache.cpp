@@ -0,0 +1,175 @@
+#include "discoverycache.hpp"
+
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <json.hpp>
+#include <vector>
+
+#include "utility.hpp"
+
+using json = nlohmann::json;
+
+/**
+ * Hubs are only replaced on deploys, an entry that is too old mostly costs a failed connect
+ * before discovery takes over.
+ */
+#define BASED_DISCOVERY_CACHE_TTL_S 3600
+
+static int64_t now_ms() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+DiscoveryCache& DiscoveryCache::get() {
+    static DiscoveryCache cache;
+    return cache;
+}
+
+DiscoveryCache::DiscoveryCache()
+    : m_path(""),
+      m_ttl_s(BASED_DISCOVERY_CACHE_TTL_S),
+      m_loaded(false),
+      m_dirty(false),
+      m_stopped(false) {}
+
+DiscoveryCache::~DiscoveryCache() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopped = true;
+    }
+    m_cv.notify_all();
+    // a pending write is still done
+    if (m_worker.joinable()) m_worker.join();
+}
+
+void DiscoveryCache::configure(const std::string& path, uint32_t ttl_s) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // a pending write still belongs to the old file
+    if (m_dirty) {
+        m_dirty = false;
+        write(m_path, dump());
+    }
+    m_path = path;
+    m_ttl_s = ttl_s;
+    m_loaded = false;
+    m_entries.clear();
+}
+
+std::string DiscoveryCache::lookup(const std::string& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_path.empty()) return "";
+    load();
+
+    if (m_entries.find(key) == m_entries.end()) return "";
+    const Entry& entry = m_entries.at(key);
+    if (now_ms() - entry.updated > (int64_t)m_ttl_s * 1000) return "";
+    return entry.uri;
+}
+
+void DiscoveryCache::store(const std::string& key, const std::string& uri) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_path.empty()) return;
+    load();
+
+    // Every open stores its hub, the file is only rewritten when the hub changed or the entry is
+    // halfway to expiring.
+    int64_t now = now_ms();
+    auto it = m_entries.find(key);
+    if (it != m_entries.end() && it->second.uri == uri &&
+        now - it->second.updated < (int64_t)m_ttl_s * 500) {
+        return;
+    }
+
+    m_entries[key] = {uri, now};
+    save();
+}
+
+void DiscoveryCache::invalidate(const std::string& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_path.empty()) return;
+    load();
+
+    if (m_entries.erase(key) == 0) return;
+    save();
+}
+
+void DiscoveryCache::load() {
+    if (m_loaded) return;
+    m_loaded = true;
+
+    std::ifstream file(m_path);
+    if (!file) return;
+
+    try {
+        json cache = json::parse(file);
+        for (auto& el : cache.items()) {
+            m_entries[el.key()] = {el.value().at("uri").get<std::string>(),
+                                   el.value().at("updated").get<int64_t>()};
+        }
+    } catch (std::exception& e) {
+        // It's only a cache, discovery will fill it again
+        BASED_LOG("Ignoring invalid discovery cache \"%s\": %s", m_path.c_str(), e.what());
+        m_entries.clear();
+    }
+}
+
+void DiscoveryCache::save() {
+    // The callers are on the io threads, the file is written by the worker
+    m_dirty = true;
+    if (!m_worker.joinable()) m_worker = std::thread(&DiscoveryCache::worker, this);
+    m_cv.notify_one();
+}
+
+void DiscoveryCache::worker() {
+    while (true) {
+        std::string path;
+        std::string data;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_stopped || m_dirty; });
+            if (!m_dirty) return;
+            m_dirty = false;
+            path = m_path;
+            data = dump();
+        }
+        write(path, data);
+    }
+}
+
+std::string DiscoveryCache::dump() {
+    json cache = json::object();
+    int64_t now = now_ms();
+    for (auto& el : m_entries) {
+        // expired entries are dropped from the file
+        if (now - el.second.updated > (int64_t)m_ttl_s * 1000) continue;
+        cache[el.first] = {{"uri", el.second.uri}, {"updated", el.second.updated}};
+    }
+    return cache.dump();
+}
+
+void DiscoveryCache::write(const std::string& path, const std::string& data) {
+    // Written next to it and renamed, so other processes never read half a file. mkstemp makes
+    // the name unique across processes and creates the file readable by the user only.
+    std::vector<char> tmp_path(path.begin(), path.end());
+    const char suffix[] = ".XXXXXX";
+    tmp_path.insert(tmp_path.end(), suffix, suffix + sizeof(suffix));
+    int fd = ::mkstemp(tmp_path.data());
+    if (fd == -1) {
+        BASED_LOG("Can't write the discovery cache next to \"%s\": %s", path.c_str(),
+                  std::strerror(errno));
+        return;
+    }
+    FILE* file = ::fdopen(fd, "w");
+    bool ok = file && std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    ok = (file ? std::fclose(file) == 0 : ::close(fd) == 0) && ok;
+    if (!ok || std::rename(tmp_path.data(), path.c_str()) != 0) {
+        BASED_LOG("Can't write the discovery cache to \"%s\"", path.c_str());
+        std::remove(tmp_path.data());
+    }
+}
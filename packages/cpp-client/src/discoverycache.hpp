@@ -0,0 +1,84 @@
+#ifndef BASED_DISCOVERY_CACHE_H
+#define BASED_DISCOVERY_CACHE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * Process-wide cache, persisted to a file, of the last hub every env was connected to. A new
+ * connection goes straight to the cached hub while discovery runs in parallel, which saves the
+ * discovery round trip (and its TLS handshake) before the first data.
+ *
+ * The file is a json object, keyed by the connect options, shared by all the processes using the
+ * same path, off until one is configured. It's read on first use and rewritten in the background
+ * whenever an entry changes.
+ */
+class DiscoveryCache {
+   public:
+    static DiscoveryCache& get();
+
+    /**
+     * @param path File to persist the cache to, empty to disable the cache.
+     * @param ttl_s Entries older than this are ignored, in seconds.
+     */
+    void configure(const std::string& path, uint32_t ttl_s);
+
+    /**
+     * @brief The cached uri for key, empty if there is none or it's expired.
+     */
+    std::string lookup(const std::string& key);
+
+    /**
+     * @brief Remember that uri works for key.
+     */
+    void store(const std::string& key, const std::string& uri);
+
+    /**
+     * @brief Forget the uri for key, when it failed.
+     */
+    void invalidate(const std::string& key);
+
+   private:
+    DiscoveryCache();
+    ~DiscoveryCache();
+
+    struct Entry {
+        std::string uri;
+        /**
+         * Unix time in ms.
+         */
+        int64_t updated;
+    };
+
+    void load();
+    /**
+     * @brief Have the worker write the entries to the file.
+     */
+    void save();
+    void worker();
+    /**
+     * @brief The unexpired entries, as they're written to the file.
+     */
+    std::string dump();
+    static void write(const std::string& path, const std::string& data);
+
+    std::mutex m_mutex;
+    std::string m_path;
+    uint32_t m_ttl_s;
+    bool m_loaded;
+    std::map<std::string, Entry> m_entries;
+
+    std::thread m_worker;
+    std::condition_variable m_cv;
+    /**
+     * The entries changed since the worker last wrote them.
+     */
+    bool m_dirty;
+    bool m_stopped;
+};
+
+#endif
@@ -0,0 +1,127 @@
+#include "dispatcher.hpp"
+
+#include <cstring>
+#include <iostream>
+
+#include "utility.hpp"
+
+/**
+ * A mailbox runs at most this many messages before going back in line, so a busy subscription
+ * can't keep a thread to itself.
+ */
+#define BASED_MAILBOX_BATCH 32
+
+Dispatcher::Dispatcher(size_t threads) : m_stopped(false) {
+    for (size_t i = 0; i < threads; i++) {
+        m_threads.emplace_back(&Dispatcher::worker, this);
+    }
+}
+
+Dispatcher::~Dispatcher() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopped = true;
+    }
+    m_cv.notify_all();
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+std::shared_ptr<Mailbox> Dispatcher::make_mailbox(MailboxOptions opts) {
+    return std::make_shared<Mailbox>(*this, opts);
+}
+
+bool Dispatcher::owns_thread(std::thread::id id) const {
+    for (auto& thread : m_threads) {
+        if (thread.get_id() == id) return true;
+    }
+    return false;
+}
+
+void Dispatcher::release(std::unique_ptr<Dispatcher> dispatcher) {
+    if (!dispatcher) return;
+    Dispatcher* d = dispatcher.release();
+    std::thread([d]() { delete d; }).detach();
+}
+
+void Dispatcher::schedule(std::shared_ptr<Mailbox> mailbox) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stopped) return;
+        m_ready.push_back(std::move(mailbox));
+    }
+    m_cv.notify_one();
+}
+
+void Dispatcher::worker() {
+    while (true) {
+        std::shared_ptr<Mailbox> mailbox;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_stopped || !m_ready.empty(); });
+            if (m_stopped) return;
+            mailbox = std::move(m_ready.front());
+            m_ready.pop_front();
+        }
+        mailbox->run();
+    }
+}
+
+Mailbox::Mailbox(Dispatcher& dispatcher, MailboxOptions opts)
+    : m_dispatcher(dispatcher), m_opts(opts), m_scheduled(false), m_closed(false), m_dropped(0) {}
+
+void Mailbox::post(std::function<void()> message) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_closed) return;
+
+        if (m_opts.capacity && m_messages.size() >= m_opts.capacity) {
+            m_dropped++;
+            if (m_opts.policy == MailboxPolicy::DROP) return;
+            m_messages.pop_front();
+        }
+        m_messages.push_back(std::move(message));
+
+        if (m_scheduled) return;
+        m_scheduled = true;
+    }
+    m_dispatcher.schedule(shared_from_this());
+}
+
+void Mailbox::close() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_closed = true;
+    m_messages.clear();
+}
+
+std::deque<std::function<void()>> Mailbox::take() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_closed = true;
+    std::deque<std::function<void()>> messages;
+    messages.swap(m_messages);
+    return messages;
+}
+
+void Mailbox::run() {
+    for (int i = 0; i < BASED_MAILBOX_BATCH; i++) {
+        std::function<void()> message;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_messages.empty()) {
+                m_scheduled = false;
+                return;
+            }
+            message = std::move(m_messages.front());
+            m_messages.pop_front();
+        }
+        try {
+            message();
+        } catch (std::exception& e) {
+            BASED_LOG("Exception in callback: %s", e.what());
+        }
+    }
+
+    // There's more, let the other mailboxes go first
+    m_dispatcher.schedule(shared_from_this());
+}
@@ -0,0 +1,132 @@
+#ifndef BASED_DISPATCHER_H
+#define BASED_DISPATCHER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * What a mailbox does with a message when it's full.
+ */
+enum MailboxPolicy {
+    /**
+     * The oldest pending message is dropped, so the callback gets the latest values. With a
+     * capacity of 1 only the latest value is ever delivered.
+     */
+    CONFLATE = 0,
+    /**
+     * The new message is dropped.
+     */
+    DROP,
+};
+
+struct MailboxOptions {
+    /**
+     * Pending messages, 0 means unbounded.
+     */
+    size_t capacity = 16;
+    MailboxPolicy policy = MailboxPolicy::CONFLATE;
+};
+
+class Mailbox;
+
+/**
+ * Pool of threads that runs the user callbacks, so that a slow callback doesn't hold up the io
+ * thread. Callbacks are posted to mailboxes: messages of one mailbox run in order and never
+ * concurrently, different mailboxes run in parallel.
+ */
+class Dispatcher {
+   public:
+    explicit Dispatcher(size_t threads);
+    /**
+     * @brief Stops the threads, messages still pending are dropped.
+     */
+    ~Dispatcher();
+
+    std::shared_ptr<Mailbox> make_mailbox(MailboxOptions opts);
+
+    /**
+     * @brief Whether the thread is one of the dispatcher threads.
+     */
+    bool owns_thread(std::thread::id id) const;
+
+    /**
+     * @brief Destroy the dispatcher on a thread of its own, for callers that can't wait for the
+     * running callbacks: the io thread, or one of the dispatcher threads, which can't join itself.
+     */
+    static void release(std::unique_ptr<Dispatcher> dispatcher);
+
+   private:
+    friend class Mailbox;
+
+    /**
+     * @brief Have one of the threads run the mailbox.
+     */
+    void schedule(std::shared_ptr<Mailbox> mailbox);
+    void worker();
+
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<std::shared_ptr<Mailbox>> m_ready;
+    bool m_stopped;
+};
+
+/**
+ * Ordered and bounded queue of callbacks, run by the dispatcher one at a time.
+ */
+class Mailbox : public std::enable_shared_from_this<Mailbox> {
+   public:
+    Mailbox(Dispatcher& dispatcher, MailboxOptions opts);
+
+    /**
+     * @brief Queue a message, applying the policy if the mailbox is full. Never blocks.
+     */
+    void post(std::function<void()> message);
+
+    /**
+     * @brief Drop the pending messages and ignore the ones posted from now on.
+     */
+    void close();
+
+    /**
+     * @brief Close the mailbox and hand back the messages it didn't run yet.
+     */
+    std::deque<std::function<void()>> take();
+
+    /**
+     * @brief Messages dropped because the mailbox was full.
+     */
+    uint64_t dropped() const { return m_dropped; }
+
+    const MailboxOptions& options() const { return m_opts; }
+
+   private:
+    friend class Dispatcher;
+
+    /**
+     * @brief Run a batch of messages, on a dispatcher thread.
+     */
+    void run();
+
+    Dispatcher& m_dispatcher;
+    MailboxOptions m_opts;
+
+    std::mutex m_mutex;
+    std::deque<std::function<void()>> m_messages;
+    /**
+     * Whether the mailbox is waiting in the dispatcher or being run, so it's never run by two
+     * threads at once.
+     */
+    bool m_scheduled;
+    bool m_closed;
+    std::atomic<uint64_t> m_dropped;
+};
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef BASED_FRAME_VIEW_H
+#define BASED_FRAME_VIEW_H
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+/**
+ * Read only view over (a part of) a received message. It doesn't own or copy the data, so it must
+ * not outlive the buffer it was created from.
+ *
+ * All the reads are bounds checked and throw std::out_of_range when the frame is shorter than
+ * what is being read, so a malformed message can't make the client read past the buffer.
+ * Integers are little endian in the protocol.
+ */
+class FrameView {
+   public:
+    FrameView() : m_data(nullptr), m_size(0){};
+    FrameView(const char* data, size_t size) : m_data(data), m_size(size){};
+    explicit FrameView(const std::string& str) : m_data(str.data()), m_size(str.size()){};
+
+    const char* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    /**
+     * @brief View over `len` bytes starting at `offset`.
+     */
+    FrameView sub(size_t offset, size_t len) const {
+        check_bounds(offset, len);
+        return FrameView(m_data + offset, len);
+    }
+
+    /**
+     * @brief View over everything from `offset` to the end.
+     */
+    FrameView sub(size_t offset) const {
+        check_bounds(offset, 0);
+        return FrameView(m_data + offset, m_size - offset);
+    }
+
+    uint8_t read_u8(size_t offset) const {
+        check_bounds(offset, 1);
+        return (uint8_t)m_data[offset];
+    }
+
+    uint32_t read_u32(size_t offset) const {
+        uint32_t res;
+        check_bounds(offset, sizeof res);
+        std::memcpy(&res, m_data + offset, sizeof res);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        res = __builtin_bswap32(res);
+#endif
+        return res;
+    }
+
+    uint64_t read_u64(size_t offset) const {
+        uint64_t res;
+        check_bounds(offset, sizeof res);
+        std::memcpy(&res, m_data + offset, sizeof res);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        res = __builtin_bswap64(res);
+#endif
+        return res;
+    }
+
+    /**
+     * @brief Little endian unsigned integer of arbitrary length (up to 8 bytes), for the fields
+     * that don't have a native size, like the 3 bytes request id.
+     */
+    uint64_t read_uint(size_t offset, size_t len) const {
+        if (len > 8) throw std::out_of_range("FrameView: integers can be at most 8 bytes");
+        check_bounds(offset, len);
+        uint64_t res = 0;
+        for (size_t i = len; i > 0; i--) {
+            res = (res << 8) | (uint8_t)m_data[offset + i - 1];
+        }
+        return res;
+    }
+
+    /**
+     * @brief The 4 bytes header at the start of every frame.
+     */
+    int32_t header() const { return (int32_t)read_u32(0); }
+
+    std::string to_string() const { return std::string(m_data, m_size); }
+
+   private:
+    const char* m_data;
+    size_t m_size;
+
+    void check_bounds(size_t offset, size_t len) const {
+        if (offset > m_size || len > m_size - offset) {
+            throw std::out_of_range("FrameView: read of " + std::to_string(len) +
+                                    " bytes at offset " + std::to_string(offset) +
+                                    " out of bounds, frame size is " + std::to_string(m_size));
+        }
+    }
+};
+
+/**
+ * Walks over all the frames packed in a single message. Every frame starts with a 4 bytes header
+ * holding the length of the rest of the frame, so the frames can be sliced off one after the
+ * other without copying.
+ */
+class FrameIterator {
+   public:
+    explicit FrameIterator(const FrameView& message) : m_message(message), m_offset(0){};
+
+    /**
+     * @brief Point `frame` to the next frame in the message.
+     *
+     * @return false when there are no frames left. Throws std::out_of_range when the header of
+     * a frame claims more bytes than what's left in the message.
+     */
+    bool next(FrameView& frame) {
+        if (m_offset >= m_message.size()) return false;
+        int32_t header = (int32_t)m_message.read_u32(m_offset);
+        int32_t len = header >> 4;
+        if (len < 0) throw std::out_of_range("FrameIterator: negative frame length");
+        frame = m_message.sub(m_offset, 4 + (size_t)len);
+        m_offset += frame.size();
+        return true;
+    }
+
+   private:
+    FrameView m_message;
+    size_t m_offset;
+};
+
+#endif
@@ -0,0 +1,230 @@
+#include "http.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <mutex>
+
+#include "utility.hpp"
+
+AsyncHttp::AsyncHttp(asio::io_service& io)
+    : m_io(io),
+      m_timer(io),
+      m_multi(nullptr),
+      m_running(0),
+      m_next_id(0),
+      m_alive(std::make_shared<bool>(true)) {
+    // Not thread safe, and curl_easy_init would only do it implicitly
+    static std::once_flag curl_init;
+    std::call_once(curl_init, []() { curl_global_init(CURL_GLOBAL_DEFAULT); });
+
+    m_multi = curl_multi_init();
+    if (!m_multi) {
+        throw std::runtime_error("curl multi object failed to initialize");
+    }
+    curl_multi_setopt(m_multi, CURLMOPT_SOCKETFUNCTION, &AsyncHttp::on_socket);
+    curl_multi_setopt(m_multi, CURLMOPT_SOCKETDATA, this);
+    curl_multi_setopt(m_multi, CURLMOPT_TIMERFUNCTION, &AsyncHttp::on_timer);
+    curl_multi_setopt(m_multi, CURLMOPT_TIMERDATA, this);
+}
+
+AsyncHttp::~AsyncHttp() {
+    m_alive.reset();
+    m_timer.cancel();
+
+    for (auto& el : m_transfers) {
+        curl_multi_remove_handle(m_multi, el.first);
+        curl_easy_cleanup(el.first);
+        curl_slist_free_all(el.second->headers);
+    }
+    m_transfers.clear();
+
+    // curl closes its sockets, the descriptors must not
+    for (auto& el : m_sockets) {
+        el.second->descriptor->release();
+    }
+    m_sockets.clear();
+
+    curl_multi_cleanup(m_multi);
+}
+
+uint64_t AsyncHttp::get(const std::string& url,
+                        const std::vector<std::string>& headers,
+                        long timeout_s,
+                        Callback cb) {
+    CURL* easy = curl_easy_init();
+    if (!easy) {
+        throw std::runtime_error("curl object failed to initialize");
+    }
+
+    std::unique_ptr<Transfer> transfer(new Transfer());
+    transfer->id = ++m_next_id;
+    transfer->easy = easy;
+    transfer->headers = NULL;
+    transfer->cb = std::move(cb);
+    transfer->response.code = CURLE_OK;
+    transfer->response.status = 0;
+
+    for (auto& header : headers) {
+        transfer->headers = curl_slist_append(transfer->headers, header.c_str());
+    }
+
+    curl_easy_setopt(easy, CURLOPT_HTTPHEADER, transfer->headers);
+    curl_easy_setopt(easy, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(easy, CURLOPT_WRITEFUNCTION, &AsyncHttp::on_body);
+    curl_easy_setopt(easy, CURLOPT_WRITEDATA, &transfer->response);
+    curl_easy_setopt(easy, CURLOPT_HEADERFUNCTION, &AsyncHttp::on_header);
+    curl_easy_setopt(easy, CURLOPT_HEADERDATA, &transfer->response);
+    curl_easy_setopt(easy, CURLOPT_TIMEOUT, timeout_s);
+    curl_easy_setopt(easy, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(easy, CURLOPT_PRIVATE, transfer.get());
+
+    // TODO: fix it
+    // This is not good, but it's a pragmatic solution for now.
+    // No sensitive data is shared with this request, and the WebSocket connection will still be
+    // over TLS
+    curl_easy_setopt(easy, CURLOPT_SSL_VERIFYPEER, 0);
+
+    uint64_t id = transfer->id;
+    m_transfers[easy] = std::move(transfer);
+
+    // curl sets the timer from here, the transfer starts when it expires
+    curl_multi_add_handle(m_multi, easy);
+    return id;
+}
+
+void AsyncHttp::cancel(uint64_t id) {
+    for (auto& el : m_transfers) {
+        if (el.second->id == id) {
+            remove(el.second.get());
+            return;
+        }
+    }
+}
+
+void AsyncHttp::remove(Transfer* transfer) {
+    CURL* easy = transfer->easy;
+    curl_multi_remove_handle(m_multi, easy);
+    curl_easy_cleanup(easy);
+    curl_slist_free_all(transfer->headers);
+    m_transfers.erase(easy);
+}
+
+int AsyncHttp::on_socket(CURL* easy, curl_socket_t s, int what, void* userp, void* socketp) {
+    AsyncHttp* self = (AsyncHttp*)userp;
+
+    if (what == CURL_POLL_REMOVE) {
+        auto it = self->m_sockets.find(s);
+        if (it != self->m_sockets.end()) {
+            // Cancels the waits in progress, and leaves the socket to curl
+            it->second->descriptor->release();
+            self->m_sockets.erase(it);
+        }
+        return 0;
+    }
+
+    auto it = self->m_sockets.find(s);
+    if (it == self->m_sockets.end()) {
+        auto socket = std::make_shared<Socket>();
+        socket->descriptor.reset(new asio::posix::stream_descriptor(self->m_io, s));
+        it = self->m_sockets.emplace(s, socket).first;
+    }
+
+    std::shared_ptr<Socket> socket = it->second;
+    socket->what = what;
+    if ((what & CURL_POLL_IN) && !socket->reading) self->wait(s, socket, true);
+    if ((what & CURL_POLL_OUT) && !socket->writing) self->wait(s, socket, false);
+    return 0;
+}
+
+int AsyncHttp::on_timer(CURLM* multi, long timeout_ms, void* userp) {
+    AsyncHttp* self = (AsyncHttp*)userp;
+
+    self->m_timer.cancel();
+    if (timeout_ms < 0) return 0;
+
+    // Even with a timeout of 0, curl doesn't allow socket_action to be called from here.
+    std::weak_ptr<bool> alive = self->m_alive;
+    self->m_timer.expires_after(std::chrono::milliseconds(timeout_ms));
+    self->m_timer.async_wait([self, alive](const asio::error_code& ec) {
+        if (ec || alive.expired()) return;
+        self->socket_action(CURL_SOCKET_TIMEOUT, 0);
+    });
+    return 0;
+}
+
+void AsyncHttp::wait(curl_socket_t s, std::shared_ptr<Socket> socket, bool read) {
+    (read ? socket->reading : socket->writing) = true;
+
+    std::weak_ptr<bool> alive = m_alive;
+    std::weak_ptr<Socket> weak_socket = socket;
+    auto type = read ? asio::posix::stream_descriptor::wait_read
+                     : asio::posix::stream_descriptor::wait_write;
+
+    socket->descriptor->async_wait(
+        type, [this, alive, weak_socket, s, read](const asio::error_code& ec) {
+            if (alive.expired()) return;
+            auto socket = weak_socket.lock();
+            if (!socket) return;
+            (read ? socket->reading : socket->writing) = false;
+            if (ec) return;
+
+            socket_action(s, read ? CURL_CSELECT_IN : CURL_CSELECT_OUT);
+
+            // Wait again if curl still wants to, unless it let go of the socket meanwhile
+            if (alive.expired()) return;
+            auto it = m_sockets.find(s);
+            if (it == m_sockets.end() || it->second != socket) return;
+            bool wanted = socket->what & (read ? CURL_POLL_IN : CURL_POLL_OUT);
+            bool waiting = read ? socket->reading : socket->writing;
+            if (wanted && !waiting) wait(s, socket, read);
+        });
+}
+
+void AsyncHttp::socket_action(curl_socket_t s, int events) {
+    curl_multi_socket_action(m_multi, s, events, &m_running);
+
+    int left;
+    CURLMsg* msg;
+    while ((msg = curl_multi_info_read(m_multi, &left))) {
+        if (msg->msg != CURLMSG_DONE) continue;
+        CURL* easy = msg->easy_handle;
+        if (m_transfers.find(easy) == m_transfers.end()) continue;
+
+        Transfer* transfer = m_transfers.at(easy).get();
+        Response response = std::move(transfer->response);
+        response.code = msg->data.result;
+        curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &response.status);
+        Callback cb = std::move(transfer->cb);
+        remove(transfer);
+
+        // The callback may start new requests, or destroy this object.
+        std::weak_ptr<bool> alive = m_alive;
+        if (cb) cb(response);
+        if (alive.expired()) return;
+    }
+}
+
+size_t AsyncHttp::on_body(void* contents, size_t size, size_t nmemb, void* userp) {
+    ((Response*)userp)->body.append((char*)contents, size * nmemb);
+    return size * nmemb;
+}
+
+size_t AsyncHttp::on_header(char* buffer, size_t size, size_t nitems, void* userp) {
+    size_t numbytes = size * nitems;
+    std::string line(buffer, numbytes);
+
+    size_t colon = line.find(':');
+    if (colon == std::string::npos) return numbytes;
+
+    std::string name = line.substr(0, colon);
+    std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+
+    size_t start = line.find_first_not_of(" \t", colon + 1);
+    size_t end = line.find_last_not_of("\r\n \t");
+    std::string value =
+        start == std::string::npos || end < start ? "" : line.substr(start, end - start + 1);
+
+    ((Response*)userp)->headers[name] = value;
+    return numbytes;
+}
@@ -0,0 +1,110 @@
+#ifndef BASED_HTTP_H
+#define BASED_HTTP_H
+
+#include <curl/curl.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <websocketpp/common/asio.hpp>
+
+/**
+ * Non blocking http requests, with curl's multi interface driven by an asio io_service: curl
+ * tells which sockets it's waiting on and for how long, the io_service waits on them and hands
+ * the events back to curl. Nothing ever blocks the io thread.
+ *
+ * Everything, including the destructor, must run on the thread of the io_service. Callbacks are
+ * called on it too.
+ */
+class AsyncHttp {
+   public:
+    struct Response {
+        CURLcode code;
+        long status;
+        /**
+         * Lowercase header name to value.
+         */
+        std::map<std::string, std::string> headers;
+        std::string body;
+    };
+
+    using Callback = std::function<void(const Response&)>;
+
+    explicit AsyncHttp(asio::io_service& io);
+    /**
+     * @brief Abort the requests in progress, their callbacks are not called.
+     */
+    ~AsyncHttp();
+
+    /**
+     * @brief Start a GET request.
+     *
+     * @param headers Full header lines, e.g. "sequence-id: 1234".
+     * @param timeout_s The request fails with CURLE_OPERATION_TIMEDOUT after this many seconds.
+     * @return The id of the request, for cancel.
+     */
+    uint64_t get(const std::string& url,
+                 const std::vector<std::string>& headers,
+                 long timeout_s,
+                 Callback cb);
+
+    /**
+     * @brief Abort a request, its callback is not called.
+     */
+    void cancel(uint64_t id);
+
+   private:
+    struct Transfer {
+        uint64_t id;
+        CURL* easy;
+        curl_slist* headers;
+        Response response;
+        Callback cb;
+    };
+
+    struct Socket {
+        std::unique_ptr<asio::posix::stream_descriptor> descriptor;
+        /**
+         * CURL_POLL_IN, CURL_POLL_OUT or both, what curl is waiting for.
+         */
+        int what = 0;
+        bool reading = false;
+        bool writing = false;
+    };
+
+    static int on_socket(CURL* easy, curl_socket_t s, int what, void* userp, void* socketp);
+    static int on_timer(CURLM* multi, long timeout_ms, void* userp);
+    static size_t on_body(void* contents, size_t size, size_t nmemb, void* userp);
+    static size_t on_header(char* buffer, size_t size, size_t nitems, void* userp);
+
+    /**
+     * @brief Wait for the socket to be readable or writable, as long as curl wants it.
+     */
+    void wait(curl_socket_t s, std::shared_ptr<Socket> socket, bool read);
+
+    /**
+     * @brief Let curl act on a socket event or a timeout, then finish the completed transfers.
+     */
+    void socket_action(curl_socket_t s, int events);
+
+    void remove(Transfer* transfer);
+
+    asio::io_service& m_io;
+    asio::steady_timer m_timer;
+    CURLM* m_multi;
+    int m_running;
+    uint64_t m_next_id;
+
+    std::map<CURL*, std::unique_ptr<Transfer>> m_transfers;
+    std::map<curl_socket_t, std::shared_ptr<Socket>> m_sockets;
+
+    /**
+     * Expires with the object, for the handlers still posted to the io_service.
+     */
+    std::shared_ptr<bool> m_alive;
+};
+
+#endif
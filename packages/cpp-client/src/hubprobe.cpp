@@ -0,0 +1,126 @@
+#include "hubprobe.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "utility.hpp"
+
+void HubProbe::run(asio::io_service& io,
+                   const std::vector<std::string>& hubs,
+                   const std::string& default_port,
+                   std::chrono::milliseconds timeout,
+                   Callback cb) {
+    if (hubs.size() < 2) {
+        // nothing to choose from
+        io.post([hubs, cb]() { cb(hubs); });
+        return;
+    }
+    // Kept alive by the handlers of its probes and timer
+    std::make_shared<HubProbe>(io, hubs, cb)->start(default_port, timeout);
+}
+
+HubProbe::HubProbe(asio::io_service& io, const std::vector<std::string>& hubs, Callback cb)
+    : m_io(io), m_timer(io), m_pending(hubs.size()), m_cb(cb) {
+    for (auto& hub : hubs) {
+        Probe probe;
+        probe.hub = hub;
+        probe.latency = std::chrono::steady_clock::duration(-1);
+        m_probes.push_back(std::move(probe));
+    }
+}
+
+void HubProbe::start(const std::string& default_port, std::chrono::milliseconds timeout) {
+    m_start = std::chrono::steady_clock::now();
+
+    auto self = shared_from_this();
+    m_timer.expires_after(timeout);
+    m_timer.async_wait([self](const asio::error_code& ec) {
+        if (ec) return;
+        BASED_LOG("Hub probe timed out, %zu hubs didn't answer", self->m_pending);
+        self->finish();
+    });
+
+    for (size_t i = 0; i < m_probes.size(); i++) {
+        probe(i, default_port);
+    }
+}
+
+void HubProbe::probe(size_t i, const std::string& default_port) {
+    Probe& probe = m_probes[i];
+
+    std::string address = probe.hub.substr(0, probe.hub.find('/'));
+    std::string host = address;
+    std::string port = default_port;
+    size_t colon = address.rfind(':');
+    if (colon != std::string::npos) {
+        host = address.substr(0, colon);
+        port = address.substr(colon + 1);
+    }
+
+    probe.resolver.reset(new asio::ip::tcp::resolver(m_io));
+    probe.socket.reset(new asio::ip::tcp::socket(m_io));
+
+    auto self = shared_from_this();
+    probe.resolver->async_resolve(
+        host, port,
+        [self, i](const asio::error_code& ec, asio::ip::tcp::resolver::results_type results) {
+            if (ec) {
+                self->done(i, ec);
+                return;
+            }
+            asio::async_connect(
+                *self->m_probes[i].socket, results,
+                [self, i](const asio::error_code& ec, const asio::ip::tcp::endpoint&) {
+                    self->done(i, ec);
+                });
+        });
+}
+
+void HubProbe::done(size_t i, const asio::error_code& ec) {
+    if (!m_cb) return;  // already finished
+
+    Probe& probe = m_probes[i];
+    if (!ec) {
+        probe.latency = std::chrono::steady_clock::now() - m_start;
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(probe.latency).count();
+        BASED_LOG("Hub \"%s\" answered in %lld us",
+                  probe.hub.substr(0, probe.hub.find('/')).c_str(), (long long)us);
+    }
+
+    // Only the TCP handshake is measured, the connection itself isn't used.
+    asio::error_code ignored;
+    probe.socket->close(ignored);
+
+    if (--m_pending == 0) finish();
+}
+
+void HubProbe::finish() {
+    if (!m_cb) return;
+
+    m_timer.cancel();
+    for (auto& probe : m_probes) {
+        asio::error_code ignored;
+        probe.resolver->cancel();
+        probe.socket->close(ignored);
+    }
+
+    std::vector<Probe*> ranked;
+    for (auto& probe : m_probes) {
+        ranked.push_back(&probe);
+    }
+    std::stable_sort(ranked.begin(), ranked.end(), [](const Probe* a, const Probe* b) {
+        bool a_ok = a->latency.count() >= 0;
+        bool b_ok = b->latency.count() >= 0;
+        if (a_ok != b_ok) return a_ok;
+        return a_ok && a->latency < b->latency;
+    });
+
+    std::vector<std::string> hubs;
+    for (auto probe : ranked) {
+        hubs.push_back(probe->hub);
+    }
+
+    Callback cb = std::move(m_cb);
+    m_cb = nullptr;
+    cb(hubs);
+}
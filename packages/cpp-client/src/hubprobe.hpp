@@ -0,0 +1,61 @@
+#ifndef BASED_HUB_PROBE_H
+#define BASED_HUB_PROBE_H
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <websocketpp/common/asio.hpp>
+
+/**
+ * Ranks the hubs returned by discovery by how long a TCP connection to each of them takes. All
+ * the hubs are probed at once on the io_service, so it takes as long as the slowest probe, at
+ * most the timeout.
+ */
+class HubProbe : public std::enable_shared_from_this<HubProbe> {
+   public:
+    /**
+     * Called once on the io thread, with all the hubs, fastest first. Hubs that couldn't be
+     * reached in time come last, in their original order.
+     */
+    using Callback = std::function<void(const std::vector<std::string>& /*ranked*/)>;
+
+    /**
+     * @param hubs "<host>[:port]/<access key>", as returned by discovery.
+     * @param default_port Port of the hubs that don't have one.
+     */
+    static void run(asio::io_service& io,
+                    const std::vector<std::string>& hubs,
+                    const std::string& default_port,
+                    std::chrono::milliseconds timeout,
+                    Callback cb);
+
+    HubProbe(asio::io_service& io, const std::vector<std::string>& hubs, Callback cb);
+
+   private:
+    struct Probe {
+        std::string hub;
+        std::unique_ptr<asio::ip::tcp::resolver> resolver;
+        std::unique_ptr<asio::ip::tcp::socket> socket;
+        /**
+         * Time to resolve and connect, negative until it's done.
+         */
+        std::chrono::steady_clock::duration latency;
+    };
+
+    void start(const std::string& default_port, std::chrono::milliseconds timeout);
+    void probe(size_t i, const std::string& default_port);
+    void done(size_t i, const asio::error_code& ec);
+    void finish();
+
+    asio::io_service& m_io;
+    asio::steady_timer m_timer;
+    std::vector<Probe> m_probes;
+    std::chrono::steady_clock::time_point m_start;
+    size_t m_pending;
+    Callback m_cb;
+};
+
+#endif
@@ -0,0 +1,63 @@
+#include "iopool.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "utility.hpp"
+
+std::atomic<size_t> IoPool::s_size(0);
+std::atomic<bool> IoPool::s_started(false);
+
+IoPool& IoPool::get() {
+    static IoPool pool(s_size ? s_size.load()
+                              : std::max<size_t>(1, std::thread::hardware_concurrency()));
+    return pool;
+}
+
+void IoPool::set_size(size_t threads) {
+    if (s_started) {
+        BASED_LOG("The io pool is already running with %zu threads, can't resize it",
+                  get().size());
+        return;
+    }
+    s_size = threads;
+}
+
+IoPool::IoPool(size_t threads) : m_next(0) {
+    s_started = true;
+    BASED_LOG("Starting io pool with %zu threads", threads);
+    for (size_t i = 0; i < threads; i++) {
+        std::unique_ptr<Context> ctx(new Context());
+        ctx->work.reset(new asio::io_service::work(ctx->io));
+        asio::io_service* io = &ctx->io;
+        ctx->thread = std::thread([io]() {
+            // A handler that throws would otherwise terminate the process, and with it every
+            // client of the pool. run() can be called again after an exception.
+            for (;;) {
+                try {
+                    io->run();
+                    return;
+                } catch (std::exception& e) {
+                    BASED_LOG("Exception in an io handler: %s", e.what());
+                } catch (...) {
+                    BASED_LOG("Unknown exception in an io handler");
+                }
+            }
+        });
+        m_contexts.push_back(std::move(ctx));
+    }
+}
+
+IoPool::~IoPool() {
+    for (auto& ctx : m_contexts) {
+        ctx->work.reset();
+        ctx->io.stop();
+    }
+    for (auto& ctx : m_contexts) {
+        ctx->thread.join();
+    }
+}
+
+IoPool::Context& IoPool::next() {
+    return *m_contexts[m_next++ % m_contexts.size()];
+}
@@ -0,0 +1,63 @@
+#ifndef BASED_IO_POOL_H
+#define BASED_IO_POOL_H
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <websocketpp/common/asio.hpp>
+
+/**
+ * Process-wide pool of io_services shared by all the connections, instead of a thread per
+ * connection. Every io_service is run by exactly one thread, so everything posted to one of them
+ * is serialized: a connection and its client can rely on that instead of locks.
+ *
+ * Connections are spread over the io_services round robin.
+ */
+class IoPool {
+   public:
+    struct Context {
+        asio::io_service io;
+        std::unique_ptr<asio::io_service::work> work;
+        std::thread thread;
+
+        /**
+         * @brief Whether the caller is running on the thread of this io_service.
+         */
+        bool running_in_this_thread() const {
+            return thread.get_id() == std::this_thread::get_id();
+        }
+    };
+
+    /**
+     * @brief The pool, it's started on the first call.
+     */
+    static IoPool& get();
+
+    /**
+     * @brief Number of threads of the pool. Only effective before the pool is started, that is
+     * before the first client is created. Defaults to the number of cores.
+     */
+    static void set_size(size_t threads);
+
+    /**
+     * @brief The io_service to use for a new connection.
+     */
+    Context& next();
+
+    size_t size() const { return m_contexts.size(); }
+
+    ~IoPool();
+
+   private:
+    explicit IoPool(size_t threads);
+
+    static std::atomic<size_t> s_size;
+    static std::atomic<bool> s_started;
+
+    std::vector<std::unique_ptr<Context>> m_contexts;
+    std::atomic<size_t> m_next;
+};
+
+#endif
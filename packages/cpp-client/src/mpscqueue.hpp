@@ -0,0 +1,104 @@
+#ifndef BASED_MPSC_QUEUE_H
+#define BASED_MPSC_QUEUE_H
+
+#include <atomic>
+#include <utility>
+
+/**
+ * Unbounded lock-free queue with many producers and a single consumer (Dmitry Vyukov's intrusive
+ * MPSC node queue). push never blocks and never fails, it's a single atomic exchange. pop must
+ * only be called from the consumer thread.
+ *
+ * A push that is still in progress can make the queue look empty to the consumer for a moment,
+ * so the producer must signal the consumer *after* push returns, never rely on a pop racing it.
+ */
+template <typename T>
+class MpscQueue {
+   public:
+    MpscQueue() : m_head(&m_stub), m_tail(&m_stub) { m_stub.next = nullptr; }
+
+    ~MpscQueue() {
+        T value;
+        while (pop(value)) {
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /**
+     * @brief Add a value at the end of the queue. Safe from any thread.
+     */
+    void push(T value) {
+        Node* node = new Node(std::move(value));
+        push_node(node);
+    }
+
+    /**
+     * @brief Take the value at the front of the queue. Consumer thread only.
+     *
+     * @return false if the queue is empty (or a push hasn't finished linking its node yet).
+     */
+    bool pop(T& value) {
+        Node* tail = m_tail;
+        Node* next = tail->next.load(std::memory_order_acquire);
+
+        if (tail == &m_stub) {
+            if (!next) return false;
+            // skip the stub
+            m_tail = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next) {
+            m_tail = next;
+            value = std::move(tail->value);
+            delete tail;
+            return true;
+        }
+
+        if (tail != m_head.load(std::memory_order_acquire)) {
+            // a producer swapped the head but didn't link it yet
+            return false;
+        }
+
+        // tail is the last node, put the stub behind it so it can be taken out
+        push_node(&m_stub);
+
+        next = tail->next.load(std::memory_order_acquire);
+        if (next) {
+            m_tail = next;
+            value = std::move(tail->value);
+            delete tail;
+            return true;
+        }
+        return false;
+    }
+
+   private:
+    struct Node {
+        Node() : next(nullptr) {}
+        explicit Node(T&& v) : next(nullptr), value(std::move(v)) {}
+        std::atomic<Node*> next;
+        T value;
+    };
+
+    void push_node(Node* node) {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        Node* prev = m_head.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    /**
+     * Producers push at the head.
+     */
+    std::atomic<Node*> m_head;
+    /**
+     * The consumer pops at the tail, only touched by the consumer thread.
+     */
+    Node* m_tail;
+    Node m_stub;
+};
+
+#endif
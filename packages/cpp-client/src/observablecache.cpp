@@ -0,0 +1,188 @@
+#include "observablecache.hpp"
+
+#include <json.hpp>
+
+using json = nlohmann::json;
+
+/**
+ * Default budget, in bytes.
+ */
+#define BASED_CACHE_BUDGET (64 * 1024 * 1024)
+
+/**
+ * Accounted for every entry on top of its value, for the map and list nodes.
+ */
+#define ENTRY_OVERHEAD 96
+
+/**
+ * A parsed json document takes about this many times the size of its serialized form.
+ */
+#define DOC_SIZE_FACTOR 3
+
+ObservableCache::Entry::Entry()
+    : checksum(0), m_value(std::make_shared<std::string>()), m_size(0) {}
+
+std::shared_ptr<const std::string> ObservableCache::Entry::value() {
+    if (!m_value) {
+        m_value = std::make_shared<const std::string>(m_doc->dump());
+        m_size = m_value->size();
+    }
+    return m_value;
+}
+
+json& ObservableCache::Entry::doc() {
+    if (!m_doc) {
+        m_doc.reset(new json(json::parse(*m_value)));
+    }
+    return *m_doc;
+}
+
+void ObservableCache::Entry::changed() {
+    // Not kept, it would only be replaced on the next read
+    m_value = nullptr;
+}
+
+void ObservableCache::Entry::set(std::shared_ptr<const std::string> value) {
+    m_value = std::move(value);
+    m_size = m_value->size();
+    m_doc = nullptr;
+}
+
+void ObservableCache::Entry::drop_doc() {
+    if (!m_doc) return;
+    value();
+    m_doc = nullptr;
+}
+
+size_t ObservableCache::Entry::bytes() const {
+    return (m_value ? m_size : 0) + (m_doc ? m_size * DOC_SIZE_FACTOR : 0);
+}
+
+ObservableCache::ObservableCache()
+    : m_budget(BASED_CACHE_BUDGET), m_bytes(0), m_entries(0), m_pinned(0), m_evictions(0) {}
+
+void ObservableCache::set_budget(size_t bytes) {
+    m_budget = bytes;
+    evict(false);
+}
+
+ObservableCache::Entry* ObservableCache::find(obs_id_t obs_id) {
+    auto it = m_slots.find(obs_id);
+    if (it == m_slots.end()) return nullptr;
+
+    Slot& slot = it->second;
+    if (!pinned(obs_id)) {
+        m_lru.splice(m_lru.begin(), m_lru, slot.lru);
+    }
+    return &slot.entry;
+}
+
+ObservableCache::Entry& ObservableCache::put(obs_id_t obs_id,
+                                             std::shared_ptr<const std::string> value,
+                                             checksum_t checksum) {
+    auto it = m_slots.find(obs_id);
+    if (it == m_slots.end()) {
+        it = m_slots.emplace(obs_id, Slot()).first;
+        it->second.bytes = 0;
+        if (!pinned(obs_id)) {
+            m_lru.push_front(obs_id);
+            it->second.lru = m_lru.begin();
+        }
+        m_entries++;
+        if (pinned(obs_id)) m_pinned++;
+    } else if (!pinned(obs_id)) {
+        m_lru.splice(m_lru.begin(), m_lru, it->second.lru);
+    }
+
+    Slot& slot = it->second;
+    slot.entry.set(std::move(value));
+    slot.entry.checksum = checksum;
+    resize(slot);
+
+    evict(!pinned(obs_id));
+    return slot.entry;
+}
+
+void ObservableCache::updated(obs_id_t obs_id) {
+    auto it = m_slots.find(obs_id);
+    if (it == m_slots.end()) return;
+    if (!pinned(obs_id)) it->second.entry.drop_doc();
+    resize(it->second);
+    evict(!pinned(obs_id));
+}
+
+void ObservableCache::erase(obs_id_t obs_id) {
+    auto it = m_slots.find(obs_id);
+    if (it == m_slots.end()) return;
+    if (pinned(obs_id)) {
+        m_pinned--;
+    } else {
+        m_lru.erase(it->second.lru);
+    }
+    m_bytes -= it->second.bytes;
+    m_slots.erase(it);
+    m_entries--;
+}
+
+void ObservableCache::pin(obs_id_t obs_id) {
+    if (m_pins[obs_id]++ > 0) return;
+
+    auto it = m_slots.find(obs_id);
+    if (it == m_slots.end()) return;
+    m_lru.erase(it->second.lru);
+    m_pinned++;
+}
+
+void ObservableCache::unpin(obs_id_t obs_id) {
+    auto pins = m_pins.find(obs_id);
+    if (pins == m_pins.end()) return;
+    if (--pins->second > 0) return;
+    m_pins.erase(pins);
+
+    auto it = m_slots.find(obs_id);
+    if (it == m_slots.end()) return;
+    it->second.entry.drop_doc();
+    resize(it->second);
+    // Just released, so it's the most recently used
+    m_lru.push_front(obs_id);
+    it->second.lru = m_lru.begin();
+    m_pinned--;
+    evict(false);
+}
+
+std::string ObservableCache::stats() {
+    json stats = {
+        {"bytes", m_bytes.load()},
+        {"entries", m_entries.load()},
+        {"pinned", m_pinned.load()},
+        {"evictions", m_evictions.load()},
+        {"budget", m_budget.load()},
+    };
+    return stats.dump();
+}
+
+bool ObservableCache::pinned(obs_id_t obs_id) {
+    return m_pins.find(obs_id) != m_pins.end();
+}
+
+void ObservableCache::evict(bool keep_front) {
+    if (m_budget == 0) return;
+
+    while (m_bytes > m_budget && !m_lru.empty()) {
+        // The entry that was just put stays, even if it's larger than the budget
+        if (keep_front && m_lru.size() == 1) break;
+        obs_id_t obs_id = m_lru.back();
+        m_lru.pop_back();
+        m_bytes -= m_slots.at(obs_id).bytes;
+        m_slots.erase(obs_id);
+        m_entries--;
+        m_evictions++;
+    }
+}
+
+void ObservableCache::resize(Slot& slot) {
+    size_t bytes = slot.entry.bytes() + ENTRY_OVERHEAD;
+    m_bytes += bytes;
+    m_bytes -= slot.bytes;
+    slot.bytes = bytes;
+}
@@ -0,0 +1,147 @@
+#ifndef BASED_OBSERVABLE_CACHE_H
+#define BASED_OBSERVABLE_CACHE_H
+
+#include <atomic>
+#include <json.hpp>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "utility.hpp"
+
+/**
+ * The last value of every observable, the base for the diffs of the server and the value
+ * returned to new subscribers and gets.
+ *
+ * Bounded by a byte budget: once over it, the least recently used entries are evicted. Entries
+ * are pinned while something depends on them (an active observable, a get waiting for an answer)
+ * and never evicted then, so pinned entries alone can go over the budget.
+ *
+ * Only used on the io thread, except stats.
+ */
+class ObservableCache {
+   public:
+    /**
+     * The value is kept as a string, or as a parsed json document once diffs are applied to it,
+     * or both. The string is shared with the callbacks, the document is patched in place and
+     * only serialized again when the string is needed.
+     */
+    class Entry {
+       public:
+        Entry();
+
+        /**
+         * 0 means the value is out of sync with the server, it can't be used as a base for
+         * diffs.
+         */
+        checksum_t checksum;
+
+        /**
+         * @brief The value as a string, serialized from the document if it changed since.
+         */
+        std::shared_ptr<const std::string> value();
+
+        /**
+         * @brief The value as a json document, parsed from the string the first time. Call
+         * changed() after modifying it.
+         */
+        nlohmann::json& doc();
+
+        /**
+         * @brief The document was modified, the string is out of date.
+         */
+        void changed();
+
+        void set(std::shared_ptr<const std::string> value);
+
+        /**
+         * @brief Keep only the string, when the value isn't diffed anymore.
+         */
+        void drop_doc();
+
+        /**
+         * @brief Estimate of the memory taken by the value.
+         */
+        size_t bytes() const;
+
+       private:
+        std::shared_ptr<const std::string> m_value;
+        std::unique_ptr<nlohmann::json> m_doc;
+        /**
+         * Length of the last serialized value, the document is estimated from it.
+         */
+        size_t m_size;
+    };
+
+    ObservableCache();
+
+    /**
+     * @param bytes Budget of the values, 0 for no limit.
+     */
+    void set_budget(size_t bytes);
+
+    /**
+     * @brief The entry of obs_id, nullptr if there is none. Counts as a use.
+     */
+    Entry* find(obs_id_t obs_id);
+
+    /**
+     * @brief Set the value of obs_id, then evict other entries if it went over budget.
+     */
+    Entry& put(obs_id_t obs_id, std::shared_ptr<const std::string> value, checksum_t checksum);
+
+    /**
+     * @brief The entry of obs_id was modified in place, account for its new size.
+     */
+    void updated(obs_id_t obs_id);
+
+    /**
+     * @brief Drop the entry of obs_id, its pins are kept.
+     */
+    void erase(obs_id_t obs_id);
+
+    /**
+     * @brief Pins are counted, every pin must be matched by an unpin. obs_id doesn't need to
+     * be in the cache. Only pinned entries keep their json document.
+     */
+    void pin(obs_id_t obs_id);
+    void unpin(obs_id_t obs_id);
+
+    /**
+     * @brief Bytes, entries, pinned entries, evictions and the budget, as json.
+     */
+    std::string stats();
+
+   private:
+    struct Slot {
+        Entry entry;
+        size_t bytes;
+        /**
+         * Position in m_lru, only valid while unpinned.
+         */
+        std::list<obs_id_t>::iterator lru;
+    };
+
+    bool pinned(obs_id_t obs_id);
+    /**
+     * @param keep_front Keep the most recently used entry, even if it's over budget on its own.
+     */
+    void evict(bool keep_front);
+    void resize(Slot& slot);
+
+    std::unordered_map<obs_id_t, Slot> m_slots;
+    /**
+     * The unpinned entries, most recently used first.
+     */
+    std::list<obs_id_t> m_lru;
+    std::unordered_map<obs_id_t, int> m_pins;
+
+    std::atomic<size_t> m_budget;
+    std::atomic<size_t> m_bytes;
+    std::atomic<size_t> m_entries;
+    std::atomic<size_t> m_pinned;
+    std::atomic<uint64_t> m_evictions;
+};
+
+#endif
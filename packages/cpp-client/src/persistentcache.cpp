@@ -0,0 +1,354 @@
+#include "persistentcache.hpp"
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "utility.hpp"
+
+#define FILE_MAGIC "BSDCACH1"
+#define FILE_MAGIC_LEN 8
+#define RECORD_MAGIC 0x42435245
+
+/**
+ * | 4 magic | 4 env length | 4 value length | 8 obs id | 8 checksum | env | value |
+ */
+#define RECORD_HEADER_LEN 28
+
+/**
+ * Files smaller than this are never compacted.
+ */
+#define BASED_PERSIST_COMPACT_MIN_BYTES (16 * 1024 * 1024)
+
+static void append_record(std::vector<char>& buff,
+                          const std::string& env,
+                          uint64_t obs_id,
+                          const char* value,
+                          uint32_t value_len,
+                          uint64_t checksum) {
+    uint32_t header[3] = {RECORD_MAGIC, (uint32_t)env.size(), value_len};
+    const char* h = (const char*)header;
+    buff.insert(buff.end(), h, h + sizeof header);
+    buff.insert(buff.end(), (const char*)&obs_id, (const char*)&obs_id + 8);
+    buff.insert(buff.end(), (const char*)&checksum, (const char*)&checksum + 8);
+    buff.insert(buff.end(), env.begin(), env.end());
+    buff.insert(buff.end(), value, value + value_len);
+}
+
+static bool write_all(int fd, const char* data, size_t len) {
+    while (len > 0) {
+        ssize_t n = ::write(fd, data, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += n;
+        len -= n;
+    }
+    return true;
+}
+
+PersistentCache& PersistentCache::get() {
+    static PersistentCache cache;
+    return cache;
+}
+
+PersistentCache::PersistentCache()
+    : m_generation(0), m_loaded(false), m_compacting(false), m_stopped(false) {}
+
+PersistentCache::~PersistentCache() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopped = true;
+    }
+    m_cv.notify_all();
+    if (m_worker.joinable()) m_worker.join();
+    close(m_file);
+}
+
+void PersistentCache::configure(const std::string& path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    close(m_file);
+    m_path = path;
+    m_loaded = false;
+    m_compacting = false;
+    uint64_t generation = ++m_generation;
+    if (path.empty()) return;
+
+    post([this, path, generation]() {
+        File file;
+        load(path, file);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (generation != m_generation) {
+            close(file);
+            return;
+        }
+        m_file = std::move(file);
+        m_loaded = true;
+    });
+}
+
+bool PersistentCache::enabled() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return !m_path.empty();
+}
+
+bool PersistentCache::lookup(const std::string& env,
+                             uint64_t obs_id,
+                             std::string& value,
+                             uint64_t& checksum) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_loaded || m_file.fd < 0) return false;
+
+    auto it = m_file.index.find(Key(env, obs_id));
+    if (it == m_file.index.end()) return false;
+
+    const Entry& entry = it->second;
+    if (entry.value_offset + entry.value_len > m_file.map_size &&
+        !map(m_path, m_file, m_file.file_size)) {
+        return false;
+    }
+    value.assign(m_file.map + entry.value_offset, entry.value_len);
+    checksum = entry.checksum;
+    return true;
+}
+
+void PersistentCache::store(const std::string& env,
+                            uint64_t obs_id,
+                            const std::string& value,
+                            uint64_t checksum) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_loaded || m_file.fd < 0) return;
+
+    std::vector<char> record;
+    record.reserve(RECORD_HEADER_LEN + env.size() + value.size());
+    append_record(record, env, obs_id, value.data(), value.size(), checksum);
+    if (!write_all(m_file.fd, record.data(), record.size())) {
+        BASED_LOG("Can't write to the persistent cache \"%s\": %s", m_path.c_str(),
+                  strerror(errno));
+        // A partial record would hide the ones appended after it
+        if (ftruncate(m_file.fd, m_file.file_size) != 0) close(m_file);
+        return;
+    }
+
+    Key key(env, obs_id);
+    auto it = m_file.index.find(key);
+    if (it != m_file.index.end()) m_file.live_bytes -= it->second.record_len;
+
+    Entry entry;
+    entry.value_offset = m_file.file_size + RECORD_HEADER_LEN + env.size();
+    entry.value_len = value.size();
+    entry.checksum = checksum;
+    entry.record_len = record.size();
+    m_file.index[key] = entry;
+    m_file.file_size += record.size();
+    m_file.live_bytes += record.size();
+
+    if (!m_compacting && m_file.file_size > BASED_PERSIST_COMPACT_MIN_BYTES &&
+        m_file.file_size > 2 * m_file.live_bytes) {
+        m_compacting = true;
+        uint64_t generation = m_generation;
+        post([this, generation]() { compact(generation); });
+    }
+}
+
+bool PersistentCache::load(const std::string& path, File& file) {
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        BASED_LOG("Can't open the persistent cache \"%s\": %s", path.c_str(), strerror(errno));
+        return false;
+    }
+    if (flock(fd, LOCK_EX | LOCK_NB) != 0) {
+        BASED_LOG("The persistent cache \"%s\" is used by another process", path.c_str());
+        ::close(fd);
+        return false;
+    }
+    file.fd = fd;
+
+    struct stat st;
+    fstat(file.fd, &st);
+    file.file_size = st.st_size;
+    if (file.file_size == 0) {
+        write_all(file.fd, FILE_MAGIC, FILE_MAGIC_LEN);
+        file.file_size = FILE_MAGIC_LEN;
+        return true;
+    }
+
+    if (!map(path, file, file.file_size) || file.file_size < FILE_MAGIC_LEN ||
+        memcmp(file.map, FILE_MAGIC, FILE_MAGIC_LEN) != 0) {
+        // It's only a cache, start over
+        BASED_LOG("Ignoring invalid persistent cache \"%s\"", path.c_str());
+        ftruncate(file.fd, 0);
+        write_all(file.fd, FILE_MAGIC, FILE_MAGIC_LEN);
+        file.file_size = FILE_MAGIC_LEN;
+        return true;
+    }
+    scan(file, FILE_MAGIC_LEN);
+    return true;
+}
+
+void PersistentCache::close(File& file) {
+    if (file.map) munmap(file.map, file.map_size);
+    file.map = nullptr;
+    file.map_size = 0;
+    if (file.fd >= 0) ::close(file.fd);  // releases the lock too
+    file.fd = -1;
+    file.file_size = 0;
+    file.live_bytes = 0;
+    file.index.clear();
+}
+
+bool PersistentCache::map(const std::string& path, File& file, size_t size) {
+    if (file.map) munmap(file.map, file.map_size);
+    file.map = nullptr;
+    file.map_size = 0;
+
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, file.fd, 0);
+    if (addr == MAP_FAILED) {
+        BASED_LOG("Can't map the persistent cache \"%s\": %s", path.c_str(), strerror(errno));
+        return false;
+    }
+    file.map = (char*)addr;
+    file.map_size = size;
+    return true;
+}
+
+void PersistentCache::scan(File& file, size_t offset) {
+    while (offset + RECORD_HEADER_LEN <= file.map_size) {
+        uint32_t header[3];
+        memcpy(header, file.map + offset, sizeof header);
+        if (header[0] != RECORD_MAGIC) break;
+        size_t record_len = RECORD_HEADER_LEN + (size_t)header[1] + header[2];
+        if (offset + record_len > file.map_size) break;
+
+        uint64_t obs_id, checksum;
+        memcpy(&obs_id, file.map + offset + 12, 8);
+        memcpy(&checksum, file.map + offset + 20, 8);
+        Key key(std::string(file.map + offset + RECORD_HEADER_LEN, header[1]), obs_id);
+
+        auto it = file.index.find(key);
+        if (it != file.index.end()) file.live_bytes -= it->second.record_len;
+
+        Entry entry;
+        entry.value_offset = offset + RECORD_HEADER_LEN + header[1];
+        entry.value_len = header[2];
+        entry.checksum = checksum;
+        entry.record_len = record_len;
+        file.index[key] = entry;
+        file.live_bytes += record_len;
+        offset += record_len;
+    }
+
+    if (offset < file.file_size) {
+        // The process stopped in the middle of a write
+        BASED_LOG("Dropping %zu bytes at the end of the persistent cache",
+                  file.file_size - offset);
+        ftruncate(file.fd, offset);
+        file.file_size = offset;
+    }
+}
+
+void PersistentCache::compact(uint64_t generation) {
+    std::string path;
+    std::map<Key, Entry> index;
+    File old;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (generation != m_generation) return;
+        path = m_path;
+        index = m_file.index;
+        // A mapping of its own, the stores go on meanwhile and remap the cache's
+        old.fd = dup(m_file.fd);
+        old.file_size = m_file.file_size;
+    }
+    size_t old_size = old.file_size;
+
+    std::string tmp_path = path + ".tmp";
+    File next;
+    next.fd = ::open(tmp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0644);
+    // Locked before it takes the real name, so no other process can get in between
+    bool ok = old.fd >= 0 && next.fd >= 0 && flock(next.fd, LOCK_EX | LOCK_NB) == 0 &&
+              map(path, old, old.file_size);
+
+    // One record at a time, the values can be large
+    ok = ok && write_all(next.fd, FILE_MAGIC, FILE_MAGIC_LEN);
+    next.file_size = FILE_MAGIC_LEN;
+    std::vector<char> record;
+    for (auto& el : index) {
+        if (!ok) break;
+        const Entry& entry = el.second;
+        record.clear();
+        append_record(record, el.first.first, el.first.second, old.map + entry.value_offset,
+                      entry.value_len, entry.checksum);
+        ok = write_all(next.fd, record.data(), record.size());
+
+        Entry moved = entry;
+        moved.value_offset = next.file_size + RECORD_HEADER_LEN + el.first.first.size();
+        next.index[el.first] = moved;
+        next.file_size += record.size();
+        next.live_bytes += record.size();
+    }
+    ok = ok && fsync(next.fd) == 0;
+    close(old);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_compacting = false;
+    if (generation != m_generation || m_file.fd < 0) {
+        close(next);
+        std::remove(tmp_path.c_str());
+        return;
+    }
+
+    // The records stored while compacting are copied as they are
+    size_t tail = next.file_size;
+    size_t tail_len = m_file.file_size - old_size;
+    if (ok && tail_len > 0) {
+        ok = (m_file.map_size >= m_file.file_size || map(path, m_file, m_file.file_size)) &&
+             write_all(next.fd, m_file.map + old_size, tail_len);
+        next.file_size += tail_len;
+    }
+    if (!ok || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        BASED_LOG("Can't compact the persistent cache \"%s\"", path.c_str());
+        close(next);
+        std::remove(tmp_path.c_str());
+        return;
+    }
+    if (!map(path, next, next.file_size)) {
+        close(next);
+        close(m_file);
+        return;
+    }
+    scan(next, tail);
+    BASED_LOG("Compacted the persistent cache from %zu to %zu bytes", m_file.file_size,
+              next.file_size);
+
+    close(m_file);
+    m_file = std::move(next);
+}
+
+void PersistentCache::post(std::function<void()> job) {
+    m_jobs.push_back(std::move(job));
+    if (!m_worker.joinable()) m_worker = std::thread(&PersistentCache::worker, this);
+    m_cv.notify_one();
+}
+
+void PersistentCache::worker() {
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_stopped || !m_jobs.empty(); });
+            if (m_stopped) return;
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+        job();
+    }
+}
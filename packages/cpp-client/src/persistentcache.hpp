@@ -0,0 +1,120 @@
+#ifndef BASED_PERSISTENT_CACHE_H
+#define BASED_PERSISTENT_CACHE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+/**
+ * Process-wide cache of observable values on disk, so that after a restart observe can fire
+ * right away with the last known value, and send its checksum so the server only answers if it
+ * changed.
+ *
+ * The file is a log of records, every store appends one and the last record of a key wins. It's
+ * memory mapped and indexed when configured, values are only copied out when they're looked up.
+ * Once most of the file is overwritten records, it's compacted into a new file. Loading and
+ * compacting run on a thread of the cache, the io threads never wait for them: lookups and
+ * stores made before the file is loaded are skipped.
+ *
+ * Only one process can use a file at a time, the others run without a persistent cache.
+ */
+class PersistentCache {
+   public:
+    static PersistentCache& get();
+
+    ~PersistentCache();
+
+    /**
+     * @param path File to persist the values to, empty (the default) to disable the cache.
+     */
+    void configure(const std::string& path);
+
+    bool enabled();
+
+    /**
+     * @brief The stored value and checksum of obs_id in env, false if there is none.
+     */
+    bool lookup(const std::string& env, uint64_t obs_id, std::string& value, uint64_t& checksum);
+
+    void store(const std::string& env,
+               uint64_t obs_id,
+               const std::string& value,
+               uint64_t checksum);
+
+   private:
+    PersistentCache();
+
+    struct Entry {
+        /**
+         * Where the value starts in the file.
+         */
+        size_t value_offset;
+        uint32_t value_len;
+        uint64_t checksum;
+        /**
+         * Size of the whole record.
+         */
+        size_t record_len;
+    };
+
+    typedef std::pair<std::string, uint64_t> Key;
+
+    /**
+     * An open cache file. Its descriptor holds the lock on it.
+     */
+    struct File {
+        int fd = -1;
+        char* map = nullptr;
+        size_t map_size = 0;
+        size_t file_size = 0;
+        /**
+         * Bytes of the records that are still the latest of their key.
+         */
+        size_t live_bytes = 0;
+        std::map<Key, Entry> index;
+    };
+
+    /**
+     * @brief Open, lock and index the file at path, on the worker.
+     */
+    static bool load(const std::string& path, File& file);
+    static void close(File& file);
+    static bool map(const std::string& path, File& file, size_t size);
+    /**
+     * @brief Index the records from offset on, and drop a last record that was cut short.
+     */
+    static void scan(File& file, size_t offset);
+    /**
+     * @brief Write the latest records to a new file and switch to it, on the worker.
+     */
+    void compact(uint64_t generation);
+
+    /**
+     * @brief Run job on the worker, m_mutex must be held.
+     */
+    void post(std::function<void()> job);
+    void worker();
+
+    std::mutex m_mutex;
+    std::string m_path;
+    /**
+     * Bumped by configure, so the worker drops what it did for the previous path.
+     */
+    uint64_t m_generation;
+    bool m_loaded;
+    bool m_compacting;
+    File m_file;
+
+    std::thread m_worker;
+    std::condition_variable m_cv;
+    std::deque<std::function<void()>> m_jobs;
+    bool m_stopped;
+};
+
+#endif
@@ -0,0 +1,364 @@
+#include "sessions.hpp"
+
+#include <cstring>
+#include <json.hpp>
+#include <set>
+
+#include "utility.hpp"
+
+using json = nlohmann::json;
+
+SharedSessions::SharedSessions() : m_enabled(false) {}
+
+void SharedSessions::set_enabled(bool enabled) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_enabled = enabled;
+}
+
+void SharedSessions::add_handle(based_id id, bool enable_tls) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Handle& handle = m_handles[id];
+    handle.enable_tls = enable_tls;
+    handle.session = new_session(enable_tls);
+    handle.session->handles.insert(id);
+}
+
+void SharedSessions::remove_handle(based_id id) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_handles.find(id) == m_handles.end()) return;
+    Handle& handle = m_handles.at(id);
+    Session* session = handle.session;
+
+    // The other handles of the session may still use the same observables, the client only
+    // unsubscribes from the server when the last subscriber goes.
+    if (session->handles.size() > 1) {
+        for (auto& el : handle.subs) {
+            if (el.second.channel) {
+                session->client->channel_unsubscribe(el.first);
+            } else {
+                session->client->unobserve(el.first);
+            }
+        }
+    }
+    session->handles.erase(id);
+    m_handles.erase(id);
+    release(session);
+    delete_released(lock);
+}
+
+std::shared_ptr<BasedClient> SharedSessions::client(based_id id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_handles.find(id) == m_handles.end()) return nullptr;
+    return m_handles.at(id).session->client;
+}
+
+void SharedSessions::connect(based_id id, const BasedConnectOpt& opts) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_handles.find(id) == m_handles.end()) return;
+    Handle& handle = m_handles.at(id);
+    Session* session = handle.session;
+
+    handle.opts = opts;
+    handle.connected = true;
+
+    std::string key = key_for(handle);
+    if (!key.empty() && key == session->key) {
+        // Already on the right session, which the others are using
+        if (session->handles.size() == 1) connect_client(*session->client, opts);
+        return;
+    }
+
+    bool joined = !key.empty() && m_shared.find(key) != m_shared.end();
+    if (session->handles.size() == 1 && !joined) {
+        // Nobody to share with, the handle keeps its session
+        if (!session->key.empty()) m_shared.erase(session->key);
+        session->key = key;
+        if (!key.empty()) m_shared[key] = session;
+        handle.auth_cb = nullptr;
+        connect_client(*session->client, opts);
+        return;
+    }
+
+    Session* to = key.empty() ? unshared_session(handle, true) : shared_session(key, handle);
+    move_handle(id, handle, to);
+    if (joined && handle.auth_cb) {
+        // it was never sent by the session the handle came from
+        to->client->set_auth_state(handle.auth_state, handle.auth_cb);
+    }
+    handle.auth_cb = nullptr;
+    delete_released(lock);
+}
+
+void SharedSessions::disconnect(based_id id) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_handles.find(id) == m_handles.end()) return;
+    Handle& handle = m_handles.at(id);
+    Session* session = handle.session;
+
+    handle.connected = false;
+
+    if (session->handles.size() == 1) {
+        if (!session->key.empty()) m_shared.erase(session->key);
+        session->key = "";
+        session->client->disconnect();
+        return;
+    }
+
+    // The others keep the connection, the handle gets a session of its own that isn't
+    // connected, with its subscriptions and auth state ready for the next connect.
+    move_handle(id, handle, unshared_session(handle, false));
+    delete_released(lock);
+}
+
+void SharedSessions::set_auth_state(based_id id,
+                                    const std::string& state,
+                                    void (*cb)(const char*)) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_handles.find(id) == m_handles.end()) return;
+    Handle& handle = m_handles.at(id);
+    Session* session = handle.session;
+
+    handle.auth_state = state;
+
+    if (!handle.connected) {
+        // The auth state is part of the key once it connects
+        handle.auth_cb = cb;
+        session->client->set_auth_state(state, cb);
+        return;
+    }
+
+    std::string key = key_for(handle);
+    bool joined = !key.empty() && key != session->key && m_shared.find(key) != m_shared.end();
+    if (key == session->key || (session->handles.size() == 1 && !joined)) {
+        // The auth state doesn't change for the others, or there are none
+        if (key != session->key) {
+            m_shared.erase(session->key);
+            session->key = key;
+            if (!key.empty()) m_shared[key] = session;
+        }
+        session->client->set_auth_state(state, cb);
+        return;
+    }
+
+    // The handle takes its auth state to another session: a new one is created with it
+    // already queued, an existing one is asked again so that cb fires.
+    handle.auth_cb = cb;
+    Session* to = key.empty() ? unshared_session(handle, true) : shared_session(key, handle);
+    move_handle(id, handle, to);
+    if (joined) to->client->set_auth_state(state, cb);
+    handle.auth_cb = nullptr;
+    delete_released(lock);
+}
+
+int SharedSessions::observe(based_id id,
+                            const std::string& name,
+                            const std::string& payload,
+                            void (*cb)(const char*, checksum_t, const char*, int)) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_handles.find(id) == m_handles.end()) return -1;
+    Handle& handle = m_handles.at(id);
+
+    int sub_id = handle.session->client->observe(name, payload, cb);
+
+    Subscription sub;
+    sub.name = name;
+    sub.payload = payload;
+    sub.on_data = cb;
+    handle.subs[sub_id] = sub;
+    return sub_id;
+}
+
+int SharedSessions::observe_patches(
+    based_id id,
+    const std::string& name,
+    const std::string& payload,
+    bool keep_value,
+    void (*cb)(const char*, bool, checksum_t, checksum_t, const char*, int)) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_handles.find(id) == m_handles.end()) return -1;
+    Handle& handle = m_handles.at(id);
+
+    int sub_id = handle.session->client->observe_patches(name, payload, keep_value, cb);
+
+    Subscription sub;
+    sub.name = name;
+    sub.payload = payload;
+    sub.on_patch = cb;
+    sub.keep_value = keep_value;
+    handle.subs[sub_id] = sub;
+    return sub_id;
+}
+
+void SharedSessions::unobserve(based_id id, int sub_id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_handles.find(id) == m_handles.end()) return;
+    Handle& handle = m_handles.at(id);
+
+    handle.subs.erase(sub_id);
+    handle.session->client->unobserve(sub_id);
+}
+
+int SharedSessions::channel_subscribe(based_id id,
+                                      const std::string& name,
+                                      const std::string& payload,
+                                      void (*cb)(const char*, const char*, int)) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_handles.find(id) == m_handles.end()) return -1;
+    Handle& handle = m_handles.at(id);
+
+    int sub_id = handle.session->client->channel_subscribe(name, payload, cb);
+
+    Subscription sub;
+    sub.channel = true;
+    sub.name = name;
+    sub.payload = payload;
+    sub.on_message = cb;
+    handle.subs[sub_id] = sub;
+    return sub_id;
+}
+
+void SharedSessions::channel_unsubscribe(based_id id, int sub_id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_handles.find(id) == m_handles.end()) return;
+    Handle& handle = m_handles.at(id);
+
+    handle.subs.erase(sub_id);
+    handle.session->client->channel_unsubscribe(sub_id);
+}
+
+void SharedSessions::set_mailbox_options(based_id id,
+                                         int sub_id,
+                                         size_t capacity,
+                                         MailboxPolicy policy) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_handles.find(id) == m_handles.end()) return;
+    Handle& handle = m_handles.at(id);
+
+    // The default for new subscriptions is a setting of the session
+    if (handle.subs.find(sub_id) != handle.subs.end()) {
+        Subscription& sub = handle.subs.at(sub_id);
+        sub.has_mailbox_options = true;
+        sub.mailbox_options.capacity = capacity;
+        sub.mailbox_options.policy = policy;
+    }
+    handle.session->client->set_mailbox_options(sub_id, capacity, policy);
+}
+
+std::string SharedSessions::stats() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::set<Session*> sessions;
+    for (auto& el : m_handles) {
+        sessions.insert(el.second.session);
+    }
+    json handles = json::array();
+    for (auto session : sessions) {
+        handles.push_back(session->handles.size());
+    }
+
+    json res = {{"handles", m_handles.size()},
+                {"sessions", sessions.size()},
+                {"shared", m_shared.size()},
+                {"handlesPerSession", handles}};
+    return res.dump();
+}
+
+std::string SharedSessions::key_for(const Handle& handle) {
+    if (!m_enabled || !handle.connected) return "";
+
+    const BasedConnectOpt& opts = handle.opts;
+    json key = {
+        handle.enable_tls, opts.url,  opts.cluster,       opts.org,          opts.project,
+        opts.env,          opts.name, opts.key,           opts.optional_key, opts.host,
+        opts.discovery_url, handle.auth_state,
+    };
+    return key.dump();
+}
+
+SharedSessions::Session* SharedSessions::new_session(bool enable_tls) {
+    Session* session = new Session();
+    session->client.reset(new BasedClient(enable_tls));
+    return session;
+}
+
+SharedSessions::Session* SharedSessions::shared_session(const std::string& key, Handle& handle) {
+    if (m_shared.find(key) != m_shared.end()) {
+        return m_shared.at(key);
+    }
+
+    BASED_LOG("Opening a new shared connection");
+    Session* session = unshared_session(handle, true);
+    session->key = key;
+    m_shared[key] = session;
+    return session;
+}
+
+SharedSessions::Session* SharedSessions::unshared_session(Handle& handle, bool connect) {
+    Session* session = new_session(handle.enable_tls);
+    if (!handle.auth_state.empty()) {
+        session->client->set_auth_state(handle.auth_state, handle.auth_cb);
+        handle.auth_cb = nullptr;
+    }
+    if (connect) connect_client(*session->client, handle.opts);
+    return session;
+}
+
+void SharedSessions::move_handle(based_id id, Handle& handle, Session* to) {
+    Session* from = handle.session;
+
+    for (auto& el : handle.subs) {
+        const Subscription& sub = el.second;
+        if (sub.channel) {
+            from->client->channel_unsubscribe(el.first);
+            to->client->add_channel_subscriber(el.first, sub.name, sub.payload, sub.on_message);
+        } else if (sub.on_patch) {
+            from->client->unobserve(el.first);
+            to->client->add_patch_observer(el.first, sub.name, sub.payload, sub.keep_value,
+                                           sub.on_patch);
+        } else {
+            from->client->unobserve(el.first);
+            to->client->add_observer(el.first, sub.name, sub.payload, sub.on_data);
+        }
+        if (sub.has_mailbox_options) {
+            to->client->set_mailbox_options(el.first, sub.mailbox_options.capacity,
+                                            sub.mailbox_options.policy);
+        }
+    }
+
+    from->handles.erase(id);
+    to->handles.insert(id);
+    handle.session = to;
+
+    release(from);
+}
+
+void SharedSessions::release(Session* session) {
+    if (!session->handles.empty()) return;
+
+    if (!session->key.empty() && m_shared.find(session->key) != m_shared.end() &&
+        m_shared.at(session->key) == session) {
+        m_shared.erase(session->key);
+    }
+    m_released.push_back(session);
+}
+
+void SharedSessions::delete_released(std::unique_lock<std::mutex>& lock) {
+    std::vector<Session*> released;
+    released.swap(m_released);
+    // Deleting a client waits for its io thread, which may be running a callback that is
+    // waiting for the lock. A caller still holding the client deletes it when it's done.
+    lock.unlock();
+    for (auto session : released) {
+        // Closes the connection, once the posted commands have run
+        delete session;
+    }
+}
+
+void SharedSessions::connect_client(BasedClient& client, const BasedConnectOpt& opts) {
+    if (!opts.url.empty()) {
+        client._connect_to_url(opts.url);
+        return;
+    }
+    client.connect(opts.cluster, opts.org, opts.project, opts.env, opts.name, opts.key,
+                   opts.optional_key, opts.host, opts.discovery_url);
+}
@@ -0,0 +1,170 @@
+#ifndef BASED_SESSIONS_H
+#define BASED_SESSIONS_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "based.h"
+#include "basedclient.hpp"
+
+/**
+ * Connection sharing for the C api. Every based_id is a handle on a session, which is a
+ * BasedClient and so one WebSocket. Without sharing every handle has a session of its own.
+ *
+ * With sharing enabled, handles that connect with the same options and the same auth state end
+ * up on the same session: the socket is opened once, identical observables are subscribed once
+ * and fanned out to the subscribers of every handle by the client, and the session is destroyed
+ * when its last handle leaves.
+ *
+ * A handle leaves its session when it connects somewhere else, changes its auth state or
+ * disconnects while other handles still use the session. Its observe and channel subscriptions
+ * move with it and keep their sub_id, calls and gets still in flight stay behind, and get an
+ * error if the session is destroyed before they're answered.
+ *
+ * The settings of a client (flush, compression, queues, dispatcher) are the ones of the session,
+ * shared by all its handles. The mailbox options of a subscription are its own and move with it.
+ */
+class SharedSessions {
+   public:
+    SharedSessions();
+
+    /**
+     * @brief Only affects the connections made from now on.
+     */
+    void set_enabled(bool enabled);
+
+    void add_handle(based_id id, bool enable_tls);
+    void remove_handle(based_id id);
+
+    /**
+     * @brief The client of the handle's session, null if there's no such handle. It stays alive
+     * while the caller holds it, even if the handle moves or the session is released meanwhile.
+     */
+    std::shared_ptr<BasedClient> client(based_id id);
+
+    /**
+     * @brief Connect with opts, or to opts.url directly when it's set.
+     */
+    void connect(based_id id, const BasedConnectOpt& opts);
+    void disconnect(based_id id);
+    void set_auth_state(based_id id, const std::string& state, void (*cb)(const char*));
+
+    int observe(based_id id,
+                const std::string& name,
+                const std::string& payload,
+                void (*cb)(const char*, checksum_t, const char*, int));
+    int observe_patches(based_id id,
+                        const std::string& name,
+                        const std::string& payload,
+                        bool keep_value,
+                        void (*cb)(const char*, bool, checksum_t, checksum_t, const char*, int));
+    void unobserve(based_id id, int sub_id);
+    int channel_subscribe(based_id id,
+                          const std::string& name,
+                          const std::string& payload,
+                          void (*cb)(const char*, const char*, int));
+    void channel_unsubscribe(based_id id, int sub_id);
+
+    /**
+     * @brief See BasedClient::set_mailbox_options. The options of a subscription are kept with
+     * it, so they're applied again when its handle moves to another session.
+     */
+    void set_mailbox_options(based_id id, int sub_id, size_t capacity, MailboxPolicy policy);
+
+    /**
+     * @brief Number of sessions and of handles on each of them, as json.
+     */
+    std::string stats();
+
+   private:
+    struct Session {
+        std::shared_ptr<BasedClient> client;
+        /**
+         * Connect options and auth state the session is shared under, empty when it's not
+         * shared.
+         */
+        std::string key;
+        std::set<based_id> handles;
+    };
+
+    /**
+     * Observe or channel subscription of a handle, what's needed to make it again on another
+     * session.
+     */
+    struct Subscription {
+        bool channel = false;
+        std::string name;
+        std::string payload;
+        void (*on_data)(const char*, checksum_t, const char*, int) = nullptr;
+        void (*on_patch)(const char*, bool, checksum_t, checksum_t, const char*, int) = nullptr;
+        bool keep_value = true;
+        void (*on_message)(const char*, const char*, int) = nullptr;
+        /**
+         * Set when the subscription has mailbox options of its own.
+         */
+        bool has_mailbox_options = false;
+        MailboxOptions mailbox_options;
+    };
+
+    struct Handle {
+        Session* session = nullptr;
+        bool enable_tls = false;
+        bool connected = false;
+        BasedConnectOpt opts;
+        std::string auth_state;
+        /**
+         * Callback of a set_auth_state made before connecting, the session the handle joins
+         * will answer it.
+         */
+        void (*auth_cb)(const char*) = nullptr;
+        std::map<sub_id_t, Subscription> subs;
+    };
+
+    /**
+     * @brief What a handle is shared under, empty if it shouldn't be shared.
+     */
+    std::string key_for(const Handle& handle);
+
+    Session* new_session(bool enable_tls);
+
+    /**
+     * @brief The shared session for key, created and connected if there isn't one yet.
+     */
+    Session* shared_session(const std::string& key, Handle& handle);
+
+    /**
+     * @brief A session of the handle's own, with its auth state queued, connected with its
+     * options if connect is set. The auth state is the first thing sent when it opens.
+     */
+    Session* unshared_session(Handle& handle, bool connect);
+
+    /**
+     * @brief Move a handle and its subscriptions to another session.
+     */
+    void move_handle(based_id id, Handle& handle, Session* to);
+
+    /**
+     * @brief Destroy the session, and close its connection, if no handle uses it anymore. It's
+     * deleted by delete_released.
+     */
+    void release(Session* session);
+
+    /**
+     * @brief Delete the released sessions, after unlocking m_mutex.
+     */
+    void delete_released(std::unique_lock<std::mutex>& lock);
+
+    static void connect_client(BasedClient& client, const BasedConnectOpt& opts);
+
+    std::map<based_id, Handle> m_handles;
+    std::map<std::string, Session*> m_shared;
+    std::vector<Session*> m_released;
+    bool m_enabled;
+    std::mutex m_mutex;
+};
+
+#endif
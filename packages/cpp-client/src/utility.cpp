@@ -1,6 +1,7 @@
 #include "utility.hpp"
 
-#include <zlib.h>
+#include "compression.hpp"
+
 #include <algorithm>
 #include <cstdint>
 #include <iomanip>
@@ -12,17 +13,6 @@
 
 using json = nlohmann::json;
 
-enum OutgoingType {
-    FUNCTION = 0,
-    SUBSCRIBE = 1,
-    UNSUBSCRIBE = 2,
-    GET = 3,
-    AUTH = 4,
-    CHANNEL_SUBSCRIBE = 5,
-    CHANNEL_PUBLISH = 6,
-    CHANNEL_UNSUBSCRIBE = 7,
-};
-
 std::string string_from_char_code(uint8_t c) {
     std::string res(1, (char)c);
     return res;
@@ -131,204 +121,105 @@ std::string Utility::encodeURIComponent(std::string decoded) {
 }
 
 std::string Utility::inflate_string(const std::string& str) {
-    // Original version of this function found on https://panthema.net/2007/0328-ZLibString.html,
-    // adapted here for our usage.
-
-    // Copyright 2007 Timo Bingmann <tb@panthema.net>
-    // Distributed under the Boost Software License, Version 1.0.
-    // (See http://www.boost.org/LICENSE_1_0.txt)
-
-    z_stream zs;  // z_stream is zlib's control structure
-    memset(&zs, 0, sizeof(zs));
-
-    if (inflateInit2(&zs, -MAX_WBITS) != Z_OK)
-        throw(std::runtime_error("inflateInit failed while decompressing."));
-
-    zs.next_in = (Bytef*)str.data();
-    zs.avail_in = str.size();
-
-    int ret;
-    char outbuffer[32768];
-    std::string outstring;
-
-    // get the decompressed bytes blockwise using repeated calls to inflate
-    do {
-        zs.next_out = reinterpret_cast<Bytef*>(outbuffer);
-        zs.avail_out = sizeof(outbuffer);
-
-        ret = inflate(&zs, 0);
-
-        if (outstring.size() < zs.total_out) {
-            outstring.append(outbuffer, zs.total_out - outstring.size());
-        }
-
-    } while (ret == Z_OK);
-
-    inflateEnd(&zs);
-
-    if (ret != Z_STREAM_END) {  // an error occurred that was not EOF
-        std::ostringstream oss;
-        oss << "Exception during zlib decompression: (" << ret << ") " << zs.msg;
-        throw(std::runtime_error(oss.str()));
-    }
+    return inflate_string(str.data(), str.size());
+}
 
-    return outstring;
+std::string Utility::inflate_string(const char* data, size_t len) {
+    return Compression::backend().inflate(data, len);
 }
 
 std::string Utility::deflate_string(const std::string& str) {
-    // Original version of this function found on https://panthema.net/2007/0328-ZLibString.html,
-    // adapted here for our usage.
-
-    // Copyright 2007 Timo Bingmann <tb@panthema.net>
-    // Distributed under the Boost Software License, Version 1.0.
-    // (See http://www.boost.org/LICENSE_1_0.txt)
-
-    z_stream zs;  // z_stream is zlib's control structure
-    memset(&zs, 0, sizeof(zs));
-
-    // See https://www.zlib.net/manual.html#Advanced for details.
-    // The windowBits argument Must match inflate_string and the js client
-
-    if (deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) !=
-        Z_OK)
-        throw(std::runtime_error("deflateInit failed while compressing."));
-
-    zs.next_in = (Bytef*)str.data();
-    zs.avail_in = str.size();  // set the z_stream's input
-
-    int ret;
-    char outbuffer[32768];
-    std::string outstring;
-
-    // retrieve the compressed bytes blockwise
-    do {
-        zs.next_out = reinterpret_cast<Bytef*>(outbuffer);
-        zs.avail_out = sizeof(outbuffer);
-
-        ret = deflate(&zs, Z_FINISH);
-
-        if (outstring.size() < zs.total_out) {
-            // append the block to the output string
-            outstring.append(outbuffer, zs.total_out - outstring.size());
-        }
-    } while (ret == Z_OK);
-
-    deflateEnd(&zs);
-
-    if (ret != Z_STREAM_END) {  // an error occurred that was not EOF
-        std::ostringstream oss;
-        oss << "Exception during zlib compression: (" << ret << ") " << zs.msg;
-        throw(std::runtime_error(oss.str()));
-    }
-
-    return outstring;
+    std::vector<uint8_t> buff;
+    Compression::backend().deflate_append(buff, str.data(), str.size(), Z_DEFAULT_COMPRESSION);
+    return std::string(buff.begin(), buff.end());
 }
 
 void Utility::append_bytes(std::vector<uint8_t>& buff, uint64_t src, size_t size) {
-    for (int i = 0; i < size; i++) {
-        uint8_t byte = (src >> (8 * i)) & 0xff;
-        buff.push_back(byte);
-    }
+    size_t offset = buff.size();
+    buff.resize(offset + size);
+    write_bytes(buff, offset, src, size);
 }
 
-void Utility::append_string(std::vector<uint8_t>& buff, std::string payload) {
-    char const* data = payload.data();
-    for (int i = 0; i < payload.length(); i++) {
-        buff.push_back(data[i]);
+void Utility::write_bytes(std::vector<uint8_t>& buff, size_t offset, uint64_t src, size_t size) {
+    uint8_t* dst = buff.data() + offset;
+    for (size_t i = 0; i < size; i++) {
+        dst[i] = (src >> (8 * i)) & 0xff;
     }
 }
+
+void Utility::append_string(std::vector<uint8_t>& buff, const std::string& payload) {
+    buff.insert(buff.end(), payload.begin(), payload.end());
+}
+
 void Utility::append_header(std::vector<uint8_t>& buff,
                             int32_t type,
                             int32_t is_deflate,
                             int32_t len) {
+    size_t offset = buff.size();
+    buff.resize(offset + 4);
+    write_header(buff, offset, type, is_deflate, len);
+}
+
+void Utility::write_header(std::vector<uint8_t>& buff,
+                           size_t offset,
+                           int32_t type,
+                           int32_t is_deflate,
+                           int32_t len) {
     // must do int32_t arithmetics because of the js client
     int32_t meta = (type << 1) + is_deflate;
     int32_t value = (len << 4) + meta;
-    for (int i = 0; i < 4; i++) {
-        uint8_t byte = (value >> (8 * i)) & 0xff;
-        buff.push_back(byte);
-    }
+    write_bytes(buff, offset, (uint32_t)value, 4);
 }
 
-std::vector<uint8_t> Utility::encode_function_message(req_id_t id,
-                                                      std::string name,
-                                                      std::string& payload) {
-    std::vector<uint8_t> buff;
-    int32_t len = 7;
-    len += 1 + name.length();
-
-    int32_t is_deflate = 0;
+/**
+ * All the encode_*_message functions append the encoded message to the end of buff, so that many
+ * messages can be encoded back to back in the same (reused) buffer without any intermediate
+ * allocation. The header is reserved first and written at the end, once the length of the
+ * (possibly deflated) message is known.
+ */
 
-    std::string p;
-    if (!payload.empty()) {
-        if (payload.length() > 150) {
-            is_deflate = 1;
-            p = deflate_string(payload);
+void Utility::encode_function_message(std::vector<uint8_t>& buff,
+                                      Compression::Policy& compression,
+                                      req_id_t id,
+                                      const std::string& name,
+                                      const std::string& payload) {
+    // Type 0 = function
+    // | 4 header | 3 id | 1 name length | * name | [* payload]
 
-        } else {
-            p = payload;
-        }
-
-        len += p.length();
-    }
-    append_header(buff, OutgoingType::FUNCTION, is_deflate, len);
+    size_t start = buff.size();
+    append_bytes(buff, 0, 4);
     append_bytes(buff, id, 3);
     buff.push_back(name.length());
     append_string(buff, name);
-    if (p.length()) {
-        append_string(buff, p);
-    }
+    int32_t is_deflate = compression.append_payload(buff, payload, OutgoingType::FUNCTION);
 
-    return buff;
+    write_header(buff, start, OutgoingType::FUNCTION, is_deflate, buff.size() - start);
 }
 
-std::vector<uint8_t> Utility::encode_observe_message(obs_id_t id,
-                                                     std::string name,
-                                                     std::string& payload,
-                                                     checksum_t checksum) {
+void Utility::encode_observe_message(std::vector<uint8_t>& buff,
+                                     Compression::Policy& compression,
+                                     obs_id_t id,
+                                     const std::string& name,
+                                     const std::string& payload,
+                                     checksum_t checksum) {
     // Type 1 = subscribe
     // | 4 header | 8 id | 8 checksum | 1 name length | * name | [* payload]
 
-    std::vector<uint8_t> buff;
-
-    /**
-     * Length in bytes. 4 B header + 8 B id + 8 B checksum,
-     * add the rest later based on payload and name.
-     */
-    int32_t len = 20;
-    len += 1 + name.length();
-
-    int32_t is_deflate = 0;
-
-    std::string p;
-    if (!payload.empty()) {
-        if (payload.length() > 150) {
-            is_deflate = 1;
-            p = deflate_string(payload);
-        } else {
-            p = payload;
-        }
-
-        len += p.length();
-    }
-    append_header(buff, OutgoingType::SUBSCRIBE, is_deflate, len);
+    size_t start = buff.size();
+    append_bytes(buff, 0, 4);
     append_bytes(buff, id, 8);
     append_bytes(buff, checksum, 8);
     buff.push_back(name.length());
     append_string(buff, name);
-    if (p.length()) {
-        append_string(buff, p);
-    }
+    int32_t is_deflate = compression.append_payload(buff, payload, OutgoingType::SUBSCRIBE);
 
-    return buff;
+    write_header(buff, start, OutgoingType::SUBSCRIBE, is_deflate, buff.size() - start);
 }
 
-std::vector<uint8_t> Utility::encode_unobserve_message(obs_id_t obs_id) {
+void Utility::encode_unobserve_message(std::vector<uint8_t>& buff, obs_id_t obs_id) {
     // Type 2 = unsubscribe
     // | 4 header | 8 id |
 
-    std::vector<uint8_t> buff;
-
     /**
      * Length in bytes. 4 B header + 8 B id
      */
@@ -336,165 +227,86 @@ std::vector<uint8_t> Utility::encode_unobserve_message(obs_id_t obs_id) {
 
     append_header(buff, OutgoingType::UNSUBSCRIBE, 0, len);
     append_bytes(buff, obs_id, 8);
-    return buff;
 }
-std::vector<uint8_t> Utility::encode_get_message(obs_id_t id,
-                                                 std::string name,
-                                                 std::string& payload,
-                                                 checksum_t checksum) {
+
+void Utility::encode_get_message(std::vector<uint8_t>& buff,
+                                 Compression::Policy& compression,
+                                 obs_id_t id,
+                                 const std::string& name,
+                                 const std::string& payload,
+                                 checksum_t checksum) {
     // Type 3 = get
     // | 4 header | 8 id | 8 checksum | 1 name length | * name | [* payload]
 
-    std::vector<uint8_t> buff;
-
-    /**
-     * Length in bytes. 4 B header + 8 B id + 8 B checksum,
-     * add the rest later based on payload and name.
-     */
-    int32_t len = 20;
-    len += 1 + name.length();
-
-    int32_t is_deflate = 0;
-
-    std::string p;
-    if (!payload.empty()) {
-        if (payload.length() > 150) {
-            is_deflate = 1;
-            p = deflate_string(payload);
-        } else {
-            p = payload;
-        }
-
-        len += p.length();
-    }
-    append_header(buff, OutgoingType::GET, is_deflate, len);
+    size_t start = buff.size();
+    append_bytes(buff, 0, 4);
     append_bytes(buff, id, 8);
     append_bytes(buff, checksum, 8);
     buff.push_back(name.length());
     append_string(buff, name);
-    if (p.length() > 0) {
-        append_string(buff, p);
-    }
+    int32_t is_deflate = compression.append_payload(buff, payload, OutgoingType::GET);
 
-    return buff;
+    write_header(buff, start, OutgoingType::GET, is_deflate, buff.size() - start);
 }
 
-std::vector<uint8_t> Utility::encode_subscribe_channel_message(obs_id_t id,
-                                                               std::string name,
-                                                               std::string& payload,
-                                                               bool is_request_subscriber) {
+void Utility::encode_subscribe_channel_message(std::vector<uint8_t>& buff,
+                                               obs_id_t id,
+                                               const std::string& name,
+                                               const std::string& payload,
+                                               bool is_request_subscriber) {
     // Type 5 = subscribe
     // | 4 header | 8 id | 1 name length | * name | * payload |
 
-    std::vector<uint8_t> buff;
-
-    /**
-     * Length in bytes. 4 B header + 8 B id + 8 B checksum,
-     * add the rest later based on payload and name.
-     */
-    int32_t len = 4;
-    len += 1 + name.length();
-
     int32_t is_deflate = is_request_subscriber ? 1 : 0;
 
-    if (!payload.empty()) {
-        // do not deflate
-        len += payload.length();
-    }
-
-    len += 8;
-
-    append_header(buff, OutgoingType::CHANNEL_SUBSCRIBE, is_deflate, len);
+    size_t start = buff.size();
+    append_bytes(buff, 0, 4);
     append_bytes(buff, id, 8);
     buff.push_back(name.length());
     append_string(buff, name);
+    // do not deflate
+    append_string(buff, payload);
 
-    if (!payload.empty()) {
-        append_string(buff, payload);
-    }
-
-    return buff;
+    write_header(buff, start, OutgoingType::CHANNEL_SUBSCRIBE, is_deflate, buff.size() - start);
 }
 
-std::vector<uint8_t> Utility::encode_unsubscribe_channel_message(obs_id_t id) {
+void Utility::encode_unsubscribe_channel_message(std::vector<uint8_t>& buff, obs_id_t id) {
     // Type 7 = channel__unsubscribe
     // | 4 header | 8 id |
 
-    std::vector<uint8_t> buff;
-
     /**
-     * Length in bytes. 4 B header + 8 B id + 8 B checksum,
-     * add the rest later based on payload and name.
+     * Length in bytes. 4 B header + 8 B id
      */
     append_header(buff, OutgoingType::CHANNEL_UNSUBSCRIBE, false, 12);
     append_bytes(buff, id, 8);
-
-    return buff;
 }
 
-std::vector<uint8_t> Utility::encode_publish_channel_message(obs_id_t id, std::string& payload) {
+void Utility::encode_publish_channel_message(std::vector<uint8_t>& buff,
+                                             Compression::Policy& compression,
+                                             obs_id_t id,
+                                             const std::string& payload) {
     // Type 6 = channel__publish
     // | 4 header | 8 id | * payload |
 
-    std::vector<uint8_t> buff;
-
-    int32_t len = 12;
-
-    int32_t is_deflate = 0;
-
-    std::string p;
-    if (!payload.empty()) {
-        if (payload.length() > 150) {
-            is_deflate = 1;
-            p = deflate_string(payload);
-        } else {
-            p = payload;
-        }
-
-        len += p.length();
-    }
-
-    append_header(buff, OutgoingType::CHANNEL_PUBLISH, is_deflate, len);
+    size_t start = buff.size();
+    append_bytes(buff, 0, 4);
     append_bytes(buff, id, 8);
+    int32_t is_deflate = compression.append_payload(buff, payload, OutgoingType::CHANNEL_PUBLISH);
 
-    if (!p.empty()) {
-        append_string(buff, p);
-    }
-
-    return buff;
+    write_header(buff, start, OutgoingType::CHANNEL_PUBLISH, is_deflate, buff.size() - start);
 }
 
-std::vector<uint8_t> Utility::encode_auth_message(std::string& auth_state) {
+void Utility::encode_auth_message(std::vector<uint8_t>& buff,
+                                  Compression::Policy& compression,
+                                  const std::string& auth_state) {
     // Type 4 = auth
     // | 4 header | * payload
 
-    std::vector<uint8_t> buff;
-
-    /**
-     * Length in bytes. 4 B header + 8 B id + 8 B checksum,
-     * add the rest later based on payload and name.
-     */
-    int32_t len = 4;
-    int32_t is_deflate = 0;
-
-    std::string p;
-    if (!auth_state.empty()) {
-        if (auth_state.length() > 150) {
-            is_deflate = 1;
-            p = deflate_string(auth_state);
-        } else {
-            p = auth_state;
-        }
-
-        len += p.length();
-    }
-    append_header(buff, 4, is_deflate, len);
-    // append_bytes(buff, p.length, )
-    if (!p.empty()) {
-        append_string(buff, p);
-    }
+    size_t start = buff.size();
+    append_bytes(buff, 0, 4);
+    int32_t is_deflate = compression.append_payload(buff, auth_state, OutgoingType::AUTH);
 
-    return buff;
+    write_header(buff, start, OutgoingType::AUTH, is_deflate, buff.size() - start);
 }
 
 int32_t Utility::get_payload_type(int32_t header) {
@@ -511,23 +323,19 @@ int32_t Utility::get_payload_is_deflate(int32_t header) {
     int32_t is_deflate = meta & 1;
     return is_deflate;
 }
-int32_t Utility::read_header(std::string buff) {
+int32_t Utility::read_header(const std::string& buff) {
     // header starts at index[0] and is 4 bytes long
-    char const* data = buff.data();
-    int32_t res = 0;
-    size_t s = 3;
-    for (int i = s; i >= 0; i--) {
-        res = res * 256 + (uint8_t)data[i];
-    }
-    return res;
+    return (int32_t)read_bytes_from_string(buff, 0, 4);
 }
 
-uint64_t Utility::read_bytes_from_string(std::string& buff, int start, int len) {
+uint64_t Utility::read_bytes_from_string(const std::string& buff, int start, int len) {
+    if (start < 0 || len < 0 || len > 8 || (size_t)start + len > buff.size()) {
+        throw std::out_of_range("read_bytes_from_string: out of bounds");
+    }
     char const* data = buff.data();
-    int32_t res = 0;
-    size_t s = len - 1 + start;  // len - 1 + start;
-    for (int i = s; i >= start; i--) {
-        res = res * 256 + (uint8_t)data[i];
+    uint64_t res = 0;
+    for (int i = start + len - 1; i >= start; i--) {
+        res = (res << 8) | (uint8_t)data[i];
     }
     return res;
 }
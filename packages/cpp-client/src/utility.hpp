@@ -26,6 +26,21 @@ using req_id_t = uint32_t;
  */
 using sub_id_t = uint32_t;
 
+namespace Compression {
+class Policy;
+}
+
+enum OutgoingType {
+    FUNCTION = 0,
+    SUBSCRIBE = 1,
+    UNSUBSCRIBE = 2,
+    GET = 3,
+    AUTH = 4,
+    CHANNEL_SUBSCRIBE = 5,
+    CHANNEL_PUBLISH = 6,
+    CHANNEL_UNSUBSCRIBE = 7,
+};
+
 // #define BASED_VERBOSE 1
 
 namespace Utility {
@@ -43,36 +58,57 @@ unsigned long int hash_env(std::string org,
                            std::string cluster = "production");
 
 std::string inflate_string(const std::string& str);
+std::string inflate_string(const char* data, size_t len);
 std::string deflate_string(const std::string& str);
 
 void append_bytes(std::vector<uint8_t>& buff, uint64_t src, size_t size);
-void append_string(std::vector<uint8_t>& buff, std::string payload);
+void write_bytes(std::vector<uint8_t>& buff, size_t offset, uint64_t src, size_t size);
+void append_string(std::vector<uint8_t>& buff, const std::string& payload);
 void append_header(std::vector<uint8_t>& buff, int32_t type, int32_t is_deflate, int32_t len);
-
-std::vector<uint8_t> encode_function_message(req_id_t id, std::string name, std::string& payload);
-std::vector<uint8_t> encode_observe_message(obs_id_t obs_id,
-                                            std::string name,
-                                            std::string& payload,
-                                            checksum_t checksum);
-std::vector<uint8_t> encode_unobserve_message(obs_id_t obs_id);
-std::vector<uint8_t> encode_get_message(obs_id_t obs_id,
-                                        std::string name,
-                                        std::string& payload,
-                                        checksum_t checksum);
-std::vector<uint8_t> encode_subscribe_channel_message(obs_id_t obs_id,
-                                                      std::string name,
-                                                      std::string& payload,
-                                                      bool is_request_subscriber);
-std::vector<uint8_t> encode_unsubscribe_channel_message(obs_id_t obs_id);
-std::vector<uint8_t> encode_publish_channel_message(obs_id_t id, std::string& payload);
-std::vector<uint8_t> encode_auth_message(std::string& auth_state);
+void write_header(std::vector<uint8_t>& buff,
+                  size_t offset,
+                  int32_t type,
+                  int32_t is_deflate,
+                  int32_t len);
+
+void encode_function_message(std::vector<uint8_t>& buff,
+                             Compression::Policy& compression,
+                             req_id_t id,
+                             const std::string& name,
+                             const std::string& payload);
+void encode_observe_message(std::vector<uint8_t>& buff,
+                            Compression::Policy& compression,
+                            obs_id_t obs_id,
+                            const std::string& name,
+                            const std::string& payload,
+                            checksum_t checksum);
+void encode_unobserve_message(std::vector<uint8_t>& buff, obs_id_t obs_id);
+void encode_get_message(std::vector<uint8_t>& buff,
+                        Compression::Policy& compression,
+                        obs_id_t obs_id,
+                        const std::string& name,
+                        const std::string& payload,
+                        checksum_t checksum);
+void encode_subscribe_channel_message(std::vector<uint8_t>& buff,
+                                      obs_id_t obs_id,
+                                      const std::string& name,
+                                      const std::string& payload,
+                                      bool is_request_subscriber);
+void encode_unsubscribe_channel_message(std::vector<uint8_t>& buff, obs_id_t obs_id);
+void encode_publish_channel_message(std::vector<uint8_t>& buff,
+                                    Compression::Policy& compression,
+                                    obs_id_t id,
+                                    const std::string& payload);
+void encode_auth_message(std::vector<uint8_t>& buff,
+                         Compression::Policy& compression,
+                         const std::string& auth_state);
 
 int32_t get_payload_type(int32_t header);
 int32_t get_payload_len(int32_t header);
 int32_t get_payload_is_deflate(int32_t header);
 
-int32_t read_header(std::string buff);
-uint64_t read_bytes_from_string(std::string& buff, int start, int len);
+int32_t read_header(const std::string& buff);
+uint64_t read_bytes_from_string(const std::string& buff, int start, int len);
 
 std::string encodeURIComponent(std::string decoded);
 std::string encode(std::string str);
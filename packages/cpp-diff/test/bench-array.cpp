@@ -0,0 +1,66 @@
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include "../src/apply-patch.hpp"
+
+// apply_array_patch on arrays of 10k to 1M objects. Every element is reused, so this is where
+// the cost of tracking reused elements shows.
+
+json make_array(int n) {
+    json items = json::array();
+    for (int i = 0; i < n; i++) {
+        items.push_back({{"id", i}, {"title", "item " + std::to_string(i)}});
+    }
+    return items;
+}
+
+void bench(std::string title, const json& a, const json& b, const json& patch) {
+    json value = a;
+    json p = patch;
+    auto t_start = std::chrono::high_resolution_clock::now();
+    Diff::apply_array_patch(value, p);
+    auto t_end = std::chrono::high_resolution_clock::now();
+    double elapsed_time_ms = std::chrono::duration<double, std::milli>(t_end - t_start).count();
+    assert(value == b);
+    std::cout << ">> " << title << " --- " << elapsed_time_ms << " ms" << std::endl;
+}
+
+int main() {
+    for (int n : {10000, 100000, 1000000}) {
+        std::string size = std::to_string(n / 1000) + "k";
+        json a = make_array(n);
+
+        {
+            json item = {{"id", -1}};
+            json b = a;
+            b.insert(b.begin(), item);
+            json patch = {n + 1, json::array({0, item}), {1, n, 0}};
+            bench("Insert at the front " + size, a, b, patch);
+        }
+
+        {
+            json b = a;
+            b[n / 2]["title"] = "changed";
+            json patch = {n,
+                          {1, n / 2, 0},
+                          {2, n / 2, {{"title", {0, "changed"}}}},
+                          {1, n - n / 2 - 1, n / 2 + 1}};
+            bench("Nested change " + size, a, b, patch);
+        }
+
+        {
+            json b = a;
+            b.insert(b.end(), a.begin(), a.end());
+            bench("Every element copied twice " + size, a, b, {2 * n, {1, n, 0}, {1, n, 0}});
+        }
+
+        {
+            json b = json::array();
+            for (int i = n - 1; i >= 0; i--) b.push_back(a[i]);
+            json patch = json::array({n});
+            for (int i = n - 1; i >= 0; i--) patch.push_back({1, 1, i});
+            bench("Reverse " + size, a, b, patch);
+        }
+    }
+}
@@ -0,0 +1,107 @@
+#ifndef DIFF_TEST_CASES_H
+#define DIFF_TEST_CASES_H
+
+#include <functional>
+#include <string>
+#include "../src/apply-patch.hpp"
+
+// The regression cases, shared by test1 and perf: each one is a title, the original value, the
+// expected value and the patch that turns the first into the second.
+typedef std::function<void(std::string, json, json, json)> TestCase;
+
+inline void run_cases(const TestCase& test) {
+    test(
+        "Object", R"({"a":"hello","b":"shurf","c":"snurx","d":{"e":"x"},"f":[1,2,3,4,5]})"_json,
+        R"({"a":"BLARF","z":true,"f":[6,1,2,8,9,4,5],"snurkypants":{"a":true,"b":false},"d":{"e":{"x":true}}})"_json,
+        R"({"a":[0,"BLARF"],"z":[0,true],"f":[2,[7,[0,6],[1,2,0],[0,8,9],[1,2,3]]],"snurkypants":[0,{"a":true,"b":false}],"d":{"e":[0,{"x":true}]},"b":[1],"c":[1]})"_json);
+
+    test("Array", R"(["a","b","c","d"])"_json, R"(["x","x","a","b","z","c","d"])"_json,
+         R"([2,[7,[0,"x","x"],[1,2,0],[0,"z"],[1,2,2]]])"_json);
+
+    test("Array to object", R"([0,1,2,3,4])"_json, R"({"0":0,"1":1,"2":2,"3":3})"_json,
+         R"({"4":[1],"___$toObject":true})"_json);
+
+    test("Object to array", R"({"0":0,"1":1,"2":2,"3":3})"_json, R"([0,1,2,3,4])"_json,
+         R"([0,[0,1,2,3,4]])"_json);
+
+    test("Object to array 2", R"({"0":0,"1":1,"2":2,"3":3})"_json, R"([0,1,2])"_json,
+         R"([0,[0,1,2]])"_json);
+
+    test(
+        "Array + nested object",
+        R"({"a":"hello","f":[{"x":true,"bla":{"flap":true}},{"x":true,"bla":{"flap":true}},{"y":true,"flurp":{"flurp":"x"}},{"z":true,"j":true}]})"_json,
+        R"({"f":[{"x":true,"bla":{"flap":true}},{"x":true,"bla":{"flap":true}},{"y":true,"flurp":{"flurp":{"flurpypants":[1,2,3]}}},{"z":true,"j":true},{"id":10},{"id":20}]})"_json,
+        R"({"f":[2,[6,[1,2,0],[2,2,{"flurp":{"flurp":[0,{"flurpypants":[1,2,3]}]}}],[1,1,3],[0,{"id":10},{"id":20}]]],"a":[1]})"_json);
+
+    test(
+        "Deep in array",
+        R"({"f":[{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}}]})"_json,
+        R"({"f":[{"kookiepants":{"x":false,"y":{"g":{"myText":"yuzi pants"}}}}]})"_json,
+        R"({"f":[2,[1,[2,0,{"kookiepants":{"x":[0,false],"y":{"g":{"myText":[0,"yuzi pants"],"x":[1],"flurpypants":[1]}}},"x":[1],"y":[1],"cnt":[1]}]]]})"_json);
+
+    test("Remove", R"([{"a":1},{"b":1},{"c":1},{"d":1},{"e":1},{"snurkels":"blurf"}])"_json,
+         R"([{"d":1},{"e":1},{"snurkels":"blurf"}])"_json, R"([2,[3,[1,3,3]]])"_json);
+
+    test(
+        "Remove nested array",
+        R"({"a":[{"a":1},{"x":1,"children":[]},{"b":1,"children":[{"x":true},{"y":true},{"z":true},{"glur":true}]},{"c":1,"children":[{"cx":true},{"cy":true},{"ca":true}]},{"e":1,"children":[{"cx":true},{"cy":true},{"ca":true}]},{"snurkels":"blurf"}]})"_json,
+        R"({"a":[{"a":1},{"x":1,"children":[{"poop":true},{"poop":true}]},{"b":1,"children":[{"z":true},{"glur":true}]},{"c":1,"children":[{"cx":true}]},{"e":1,"children":[]},{"snurkels":"blurf"}]})"_json,
+        R"({"a":[2,[6,[1,1,0],[2,1,{"children":[2,[2,[0,{"poop":true},{"poop":true}]]]},{"children":[2,[2,[1,2,2]]]},{"children":[2,[1,[1,1,0]]]},{"children":[0,[]]}],[1,1,5]]]})"_json);
+
+    test(
+        "Remove deep",
+        R"([{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/fc_viktoria_kahl.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/tsv_karlburg.png"}}],"id":"ma99ee6d08","title":"FC Viktoria Kahl vs. TSV Karlburg","competition":{"id":"co72532025","title":"Qualifikation Toto-Pokal-Bayernliga 20/21"},"date":1600792200000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/baiersdorfer_sv.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/tsv_buch.png"}}],"id":"mae7991349","title":"Baiersdorfer SV vs. TSV Buch","competition":{"id":"co7ddf2fee","title":"Landesliga Nordost"},"date":1600794000000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://v2images.imgix.net/df38dd9f.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/sc_großschwarzenlohe.png"}}],"id":"ma75bc6c84","title":"SV Schwaig vs. SC Großschwarzenlohe","competition":{"id":"co7ddf2fee","title":"Landesliga Nordost"},"date":1600794000000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{},{}],"id":"maba5d99a","title":"Spfr. Bad Ems vs. SG Nievern II","competition":{"id":"coa655bbde","title":"1.Runde Bitburger-Kreispokal A/B Rhein-Lahn 2020/21"},"date":1600795800000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/1_FUßBALL-CLUB_KOeLN_01@07_E_V.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/fortuna_duesseldorf_u23.png"}}],"id":"mab6e85f0f","title":"1. FC Köln U21 vs. Fortuna Düsseldorf U23","competition":{"id":"coc15614f6","title":"Regionalliga West"},"date":1600862400000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/Heider_SV_1925_e_V.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/1_FC_Phoenix_Luebeck.png"}}],"id":"ma72188b47","title":"Heider SV vs. 1.FC Phönix Lübeck","competition":{"id":"co776267c5","title":"Regionalliga Nord Gruppe Nord"},"date":1600873200000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","title":"VfB Oldenburg vs. SSV Jeddeloh","image":{"cover":"https://v2images.imgix.net/87492e24.png","thumb":"https://v2images.imgix.net/87492e24.png"},"date":1600873200000,"teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/vfb_oldenburg.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/ssv_jeddeloh.png"}}],"competition":{"id":"co1587234f","title":"Regionalliga Nord Gruppe Süd"},"id":"ma2589b9eb"},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/hsc_hannover.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/hannover_96_ii_u23.png"}}],"id":"ma93898d5c","competition":{"id":"co1587234f","title":"Regionalliga Nord Gruppe Süd"},"date":1600873200000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/tsv_1861_noerdlingen.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/tsv_schwaben_augsburg.png"}}],"id":"ma766dd1d8","title":"TSV 1861 Nördlingen vs. TSV Schwaben Augsburg","competition":{"id":"co72532025","title":"Qualifikation Toto-Pokal-Bayernliga 20/21"},"date":1600879500000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/altona_93_1.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/holstein_kiel_ii.png"}}],"id":"ma3de028","title":"Altona 93 1. vs. Holstein Kiel II","competition":{"id":"co776267c5","title":"Regionalliga Nord Gruppe Nord"},"date":1600880400000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/fc_oberneuland.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/VfL_Wolfsburg_e_V.png"}}],"id":"ma9472610a","title":"FC Oberneuland vs. VfL Wolfsburg II","competition":{"id":"co1587234f","title":"Regionalliga Nord Gruppe Süd"},"date":1600880400000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/ulmwolfsburg.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/1fc_germania_egestorf-langreder.png"}}],"id":"ma75bd54f","title":"U.S.I. Lupo-Martini Wolfsburg vs. 1.FC Germania Egestorf-Langreder","competition":{"id":"co9906b52f","title":"Oberliga Niedersachsen Hannover / Braunschweig"},"date":1600880400000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://v2images.imgix.net/f496a429.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/GW_Firrel_e_V.png"}}],"id":"mae43d088d","title":"BV Essen vs. GW Firrel","competition":{"id":"coa8a41bf1","title":"Landesliga Weser-Ems"},"date":1600880400000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://v2images.imgix.net/78048767.png"}},{}],"id":"ma60164022","title":"FV 09 Schwalbach vs. FV Bischmisheim","competition":{"id":"co8f24e6dd","title":"Saarlandliga"},"date":1600880400000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/fc_eintracht_norderstedt.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/hamburger_sv_iii.png"}}],"id":"mae9933610","title":"FC Eintracht Norderstedt vs. Hamburger SV II","competition":{"id":"co776267c5","title":"Regionalliga Nord Gruppe Nord"},"date":1600880400000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/fc_eilenburg.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/vfc_plauen.png"}}],"id":"maa3db9e53","title":"FC Eilenburg vs. VFC Plauen","competition":{"id":"co86127161","title":"NOFV-Oberliga Süd"},"date":1600880400000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://v2images.imgix.net/c1a8854a.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/turu_duesseldorf.png"}}],"id":"maf88857d9","title":"Ratingen 04/19 vs. TuRU Düsseldorf","competition":{"id":"co66406c9c","title":"Oberliga Niederrhein"},"date":1600882200000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/sc_vikt_griesheim.png"}},{}],"id":"ma9600960a","title":"SC Vikt. Griesheim vs. FC Eddersheim","competition":{"id":"cob1ec3cce","title":"Lotto Hessenliga"},"date":1600882200000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/cronenberger_sc.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/tv_jahn_dinslaken_hiesfeld.png"}}],"id":"ma1051ce2a","title":"Cronenberger SC vs. TV Jahn Dinslaken-Hiesfeld","competition":{"id":"co66406c9c","title":"Oberliga Niederrhein"},"date":1600882200000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/sc_wiedenbrueck.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/borussia_dortmund_ii.png"}}],"id":"ma9bd4d090","title":"SC Wiedenbrück vs. Borussia Dortmund U23 2","competition":{"id":"coc15614f6","title":"Regionalliga West"},"date":1600882200000}])"_json, R"([{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{},{}],"id":"maba5d99a","title":"Spfr. Bad Ems vs. SG Nievern II","competition":{"id":"coa655bbde","title":"1.Runde Bitburger-Kreispokal A/B Rhein-Lahn 2020/21"},"date":1600795800000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/1_FUßBALL-CLUB_KOeLN_01@07_E_V.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/fortuna_duesseldorf_u23.png"}}],"id":"mab6e85f0f","title":"1. FC Köln U21 vs. Fortuna Düsseldorf U23","competition":{"id":"coc15614f6","title":"Regionalliga West"},"date":1600862400000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/Heider_SV_1925_e_V.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/1_FC_Phoenix_Luebeck.png"}}],"id":"ma72188b47","title":"Heider SV vs. 1.FC Phönix Lübeck","competition":{"id":"co776267c5","title":"Regionalliga Nord Gruppe Nord"},"date":1600873200000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","title":"VfB Oldenburg vs. SSV Jeddeloh","image":{"cover":"https://v2images.imgix.net/87492e24.png","thumb":"https://v2images.imgix.net/87492e24.png"},"date":1600873200000,"teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/vfb_oldenburg.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/ssv_jeddeloh.png"}}],"competition":{"id":"co1587234f","title":"Regionalliga Nord Gruppe Süd"},"id":"ma2589b9eb"},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/hsc_hannover.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/hannover_96_ii_u23.png"}}],"id":"ma93898d5c","competition":{"id":"co1587234f","title":"Regionalliga Nord Gruppe Süd"},"date":1600873200000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/tsv_1861_noerdlingen.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/tsv_schwaben_augsburg.png"}}],"id":"ma766dd1d8","title":"TSV 1861 Nördlingen vs. TSV Schwaben Augsburg","competition":{"id":"co72532025","title":"Qualifikation Toto-Pokal-Bayernliga 20/21"},"date":1600879500000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/altona_93_1.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/holstein_kiel_ii.png"}}],"id":"ma3de028","title":"Altona 93 1. vs. Holstein Kiel II","competition":{"id":"co776267c5","title":"Regionalliga Nord Gruppe Nord"},"date":1600880400000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/fc_oberneuland.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/VfL_Wolfsburg_e_V.png"}}],"id":"ma9472610a","title":"FC Oberneuland vs. VfL Wolfsburg II","competition":{"id":"co1587234f","title":"Regionalliga Nord Gruppe Süd"},"date":1600880400000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/ulmwolfsburg.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/1fc_germania_egestorf-langreder.png"}}],"id":"ma75bd54f","title":"U.S.I. Lupo-Martini Wolfsburg vs. 1.FC Germania Egestorf-Langreder","competition":{"id":"co9906b52f","title":"Oberliga Niedersachsen Hannover / Braunschweig"},"date":1600880400000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://v2images.imgix.net/f496a429.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/GW_Firrel_e_V.png"}}],"id":"mae43d088d","title":"BV Essen vs. GW Firrel","competition":{"id":"coa8a41bf1","title":"Landesliga Weser-Ems"},"date":1600880400000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://v2images.imgix.net/78048767.png"}},{}],"id":"ma60164022","title":"FV 09 Schwalbach vs. FV Bischmisheim","competition":{"id":"co8f24e6dd","title":"Saarlandliga"},"date":1600880400000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/fc_eintracht_norderstedt.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/hamburger_sv_iii.png"}}],"id":"mae9933610","title":"FC Eintracht Norderstedt vs. Hamburger SV II","competition":{"id":"co776267c5","title":"Regionalliga Nord Gruppe Nord"},"date":1600880400000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/fc_eilenburg.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/vfc_plauen.png"}}],"id":"maa3db9e53","title":"FC Eilenburg vs. VFC Plauen","competition":{"id":"co86127161","title":"NOFV-Oberliga Süd"},"date":1600880400000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://v2images.imgix.net/c1a8854a.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/turu_duesseldorf.png"}}],"id":"maf88857d9","title":"Ratingen 04/19 vs. TuRU Düsseldorf","competition":{"id":"co66406c9c","title":"Oberliga Niederrhein"},"date":1600882200000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/sc_vikt_griesheim.png"}},{}],"id":"ma9600960a","title":"SC Vikt. Griesheim vs. FC Eddersheim","competition":{"id":"cob1ec3cce","title":"Lotto Hessenliga"},"date":1600882200000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/cronenberger_sc.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/tv_jahn_dinslaken_hiesfeld.png"}}],"id":"ma1051ce2a","title":"Cronenberger SC vs. TV Jahn Dinslaken-Hiesfeld","competition":{"id":"co66406c9c","title":"Oberliga Niederrhein"},"date":1600882200000},{"sport":{"id":"spaea4379e","title":"Football"},"type":"match","teams":[{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/sc_wiedenbrueck.png"}},{"image":{"logo":"https://sasstorageproduction.blob.core.windows.net/sasblob/Club/Logos/borussia_dortmund_ii.png"}}],"id":"ma9bd4d090","title":"SC Wiedenbrück vs. Borussia Dortmund U23 2","competition":{"id":"coc15614f6","title":"Regionalliga West"},"date":1600882200000}])"_json,
+        R"([2,[17,[1,17,3]]])"_json);
+
+    test("Flip", R"({"$id":"root","flurp":[1,2,3,4]})"_json,
+         R"({"$id":"root","flurp":[1,3,2,4]})"_json,
+         R"({"flurp":[2,[4,[1,1,0],[1,1,2],[1,1,1],[1,1,3]]]})"_json);
+
+    test(
+        "Weird array",
+        R"( {"upcoming":[{"id":"maug8"},{"id":"maug7"},{"id":"maug5"},{"id":"maug4"},{"id":"maug2"},{"id":"maug11"},{"id":"maug10"},{"id":"maug1"},{"id":"mau2"},{"id":"mau1"}],"past":[{"id":"map8"},{"id":"map7"},{"id":"map5"},{"id":"map4"},{"id":"map2"},{"id":"map14"},{"id":"map13"},{"id":"map11"},{"id":"map10"},{"id":"map1"}],"live":[]})"_json,
+        R"({"upcoming":[{"id":"mau2"},{"id":"maug1"},{"id":"maug2"},{"id":"maug4"},{"id":"maug5"},{"id":"maug7"},{"id":"maug8"},{"id":"maug10"},{"id":"maug11"},{"id":"maug13"}],"past":[{"id":"map1"},{"id":"map2"},{"id":"map4"},{"id":"map5"},{"id":"map7"},{"id":"map8"},{"id":"map10"},{"id":"map11"},{"id":"map13"},{"id":"map14"}],"live":[{"id":"mau1"}]})"_json,
+        R"({"upcoming":[2,[10,[1,1,8],[1,1,7],[1,1,4],[1,1,3],[1,1,2],[1,1,1],[1,1,0],[1,1,6],[1,1,5],[2,9,{"id":[0,"maug13"]}]]],"past":[2,[10,[1,1,9],[1,1,4],[1,1,3],[1,1,2],[1,1,1],[1,1,0],[1,1,8],[1,1,7],[1,1,6],[1,1,5]]],"live":[2,[1,[0,{"id":"mau1"}]]]})"_json);
+
+    test(
+        "Weird array 2 register copy",
+        R"({"upcoming":[{"id":"mau1"},{"id":"mau2"},{"id":"maug1"},{"id":"maug2"},{"id":"maug4"},{"id":"maug5"},{"id":"maug7"},{"id":"maug8"},{"id":"maug10"},{"id":"maug11"}],"past":[{"id":"map1"},{"id":"map2"},{"id":"map4"},{"id":"map5"},{"id":"map7"},{"id":"map8"},{"id":"map10"},{"id":"map11"},{"id":"map13"},{"id":"map14"}],"live":[]})"_json,
+        R"({"upcoming":[{"id":"mau2"},{"id":"maug1"},{"id":"maug2"},{"id":"maug4"},{"id":"maug5"},{"id":"maug7"},{"id":"maug8"},{"id":"maug10"},{"id":"maug11"},{"id":"maug13"}],"past":[{"id":"map1"},{"id":"map2"},{"id":"map4"},{"id":"map5"},{"id":"map7"},{"id":"map8"},{"id":"map10"},{"id":"map11"},{"id":"map13"},{"id":"map14"}],"live":[{"id":"mau1"}]})"_json,
+        R"({"upcoming":[2,[10,[1,9,1],[2,9,{"id":[0,"maug13"]}]]],"live":[2,[1,[0,{"id":"mau1"}]]]})"_json);
+
+    test(
+        "Weird array 3 register copy",
+        R"({"past":[{"id":"map1"},{"id":"map2"},{"id":"map4"},{"id":"map5"},{"id":"map7"},{"id":"map8"},{"id":"map10"},{"id":"map11"},{"id":"map13"},{"id":"map14"}]})"_json,
+        R"({"past":[{"id":"mau1"},{"id":"map1"},{"id":"map2"},{"id":"map4"},{"id":"map5"},{"id":"map7"},{"id":"map8"},{"id":"map10"},{"id":"map11"},{"id":"map13"}]})"_json,
+        R"({"past":[2,[10,[2,0,{"id":[0,"mau1"]}],[1,9,0]]]})"_json);
+
+    test(
+        "Array + nested object lots the same",
+        R"({"f":[{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"gurken":true},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}}]})"_json,
+        R"({"f":[{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"flurb":true},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"flura":true},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"gurken":true},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"gurky":true},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"kookiepants":{"x":false,"y":{"g":{"myText":"yuzi pants"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}},{"x":true,"y":true,"cnt":324,"kookiepants":{"x":true,"y":{"g":{"x":true,"flurpypants":"x","myText":"fdwefjwef ewofihewfoihwef weoifh"}}}}]})"_json,
+        R"({"f":[2,[1000,[1,1,0],[2,1,{"flurb":[0,true],"x":[1],"y":[1],"cnt":[1],"kookiepants":[1]}],[1,1,2],[2,3,{"flura":[0,true],"x":[1],"y":[1],"cnt":[1],"kookiepants":[1]}],[1,4,4],[2,8,{"gurky":[0,true],"x":[1],"y":[1],"cnt":[1],"kookiepants":[1]}],[1,1,9],[2,10,{"kookiepants":{"x":[0,false],"y":{"g":{"myText":[0,"yuzi pants"],"x":[1],"flurpypants":[1]}}},"x":[1],"y":[1],"cnt":[1]}],[1,989,11]]]})"_json);
+
+    // test("",
+    //     R"()"_json,
+    //     R"()"_json,
+    //     R"()"_json
+    // );
+}
+
+// Patches that don't fit their value: each one is a title, the original value and the patch.
+// Applying them throws.
+typedef std::function<void(std::string, json, json)> BadCase;
+
+inline void run_bad_cases(const BadCase& test) {
+    test("Copy past the end", R"({"f":[1,2,3]})"_json, R"({"f":[2,[3,[1,1,0],[1,2,2]]]})"_json);
+
+    test("Negative pivot", R"([1,2,3])"_json, R"([2,[2,[1,1,-1],[1,1,0]]])"_json);
+
+    test("Patch range past the end", R"([{"a":1},{"a":2}])"_json,
+         R"([2,[3,[1,1,0],[2,1,{"a":[0,3]},{"a":[0,4]}]]])"_json);
+
+    test("Missing nested key", R"({"a":1,"d":{"x":1}})"_json,
+         R"({"a":[0,2],"d":{"e":[2,[1,[1,1,0]]]}})"_json);
+}
+
+#endif
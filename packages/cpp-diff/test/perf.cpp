@@ -0,0 +1,134 @@
+#include <cassert>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+#include "cases.hpp"
+
+// Regression and perf suite: the cases of test1, then large documents. Every case checks the
+// result against the expected document, then compares patching a copy (how apply_patch used to
+// work) with patching in place.
+
+json make_item(int i) {
+    return {
+        {"id", "ma" + std::to_string(i)},
+        {"title", "Team " + std::to_string(i) + " vs. Team " + std::to_string(i + 1)},
+        {"date", 1600792200000 + i},
+        {"teams", {{{"logo", "https://v2images.imgix.net/" + std::to_string(i) + ".png"}},
+                   {{"logo", "https://v2images.imgix.net/" + std::to_string(i + 1) + ".png"}}}},
+        {"competition", {{"id", "co" + std::to_string(i % 16)}, {"title", "Regionalliga West"}}},
+    };
+}
+
+json make_doc(int n) {
+    json items = json::array();
+    for (int i = 0; i < n; i++) items.push_back(make_item(i));
+    return {{"meta", {{"version", 1}, {"count", n}}}, {"items", items}};
+}
+
+double time_ms(std::function<void()> fn) {
+    auto t_start = std::chrono::high_resolution_clock::now();
+    fn();
+    auto t_end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(t_end - t_start).count();
+}
+
+void test(std::string title, const json& a, const json& b, const json& patch) {
+    json copy_res;
+    double copy_ms = time_ms([&]() { copy_res = Diff::apply_patch(a, patch); });
+    assert(copy_res == b);
+
+    json value = a;
+    json p = patch;
+    double in_place_ms = time_ms([&]() { Diff::apply_patch_in_place(value, p); });
+    assert(value == b);
+
+    std::cout << ">> " << title << " --- copy " << copy_ms << " ms, in place " << in_place_ms
+              << " ms" << std::endl;
+}
+
+// In place there's no rollback: once the patch throws, value is unspecified and has to be
+// discarded, the only thing to check is that it throws instead of producing a wrong document.
+void test_bad(std::string title, json a, json patch) {
+    bool thrown = false;
+    try {
+        Diff::apply_patch_in_place(a, patch);
+    } catch (std::exception& e) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << ">> " << title << " --- throws" << std::endl;
+}
+
+int main() {
+    run_cases(test);
+    run_bad_cases(test_bad);
+
+    int n = 2000;
+    json a = make_doc(n);
+    std::cout << "document of " << a.dump().size() / 1024 << " kb" << std::endl;
+
+    {
+        json b = a;
+        b["meta"]["version"] = 2;
+        test("Field changed", a, b, R"({"meta":{"version":[0,2]}})"_json);
+    }
+
+    {
+        json b = a;
+        b["items"][n / 2]["title"] = "Changed";
+        b["items"][n / 2].erase("date");
+        json patch = {{"items",
+                       {2,
+                        {n,
+                         {1, n / 2, 0},
+                         {2, n / 2, {{"title", {0, "Changed"}}, {"date", {1}}}},
+                         {1, n - n / 2 - 1, n / 2 + 1}}}}};
+        test("Nested change in array", a, b, patch);
+    }
+
+    {
+        json b = a;
+        json& items = b["items"];
+        items.insert(items.begin(), make_item(-1));
+        json patch = {{"items", {2, {n + 1, {0, make_item(-1)}, {1, n, 0}}}}};
+        test("Insert at the front", a, b, patch);
+    }
+
+    {
+        json b = a;
+        json& items = b["items"];
+        items.erase(items.begin());
+        items.push_back(a["items"][0]);
+        json patch = {{"items", {2, {n, {1, n - 1, 1}, {1, 1, 0}}}}};
+        test("Rotate", a, b, patch);
+    }
+
+    {
+        json b = a;
+        json& items = b["items"];
+        items.push_back(a["items"][0]);
+        items[0]["title"] = "Copy";
+        json patch = {{"items", {2, {n + 1, {2, 0, {{"title", {0, "Copy"}}}}, {1, n - 1, 1},
+                                     {1, 1, 0}}}}};
+        test("Register copy", a, b, patch);
+    }
+
+    {
+        json b = a;
+        b["items"] = json::array();
+        for (int i = n - 1; i >= 0; i--) b["items"].push_back(a["items"][i]);
+        json ops = json::array({n});
+        for (int i = n - 1; i >= 0; i--) ops.push_back({1, 1, i});
+        test("Reverse", a, b, {{"items", {2, ops}}});
+    }
+
+    {
+        json b = a;
+        b["items"] = json::array();
+        for (int i = 0; i < n; i += 2) b["items"].push_back(a["items"][i]);
+        json ops = json::array({n / 2});
+        for (int i = 0; i < n; i += 2) ops.push_back({1, 1, i});
+        test("Remove every other", a, b, {{"items", {2, ops}}});
+    }
+}